@@ -0,0 +1,214 @@
+// Tests the disc metadata cache against the fixture in fixtures/DISCCACHE.BIN.
+// The cache is kept in mc0:/SYS-CONF/DISCCACHE.BIN relative to a temporary directory
+#include "disc_cache.h"
+#include <errno.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define CACHE_PATH "mc0:/SYS-CONF/DISCCACHE.BIN"
+#define CACHE_HEADER_SIZE 20
+#define CACHE_RECORD_SIZE 128
+#define CACHE_SIZE (CACHE_HEADER_SIZE + 32 * CACHE_RECORD_SIZE)
+
+static int failures = 0;
+
+#define CHECK(cond, ...)                                                                                                                   \
+  do {                                                                                                                                     \
+    if (!(cond)) {                                                                                                                         \
+      printf("FAIL %s:%d: ", __FILE__, __LINE__);                                                                                          \
+      printf(__VA_ARGS__);                                                                                                                 \
+      printf("\n");                                                                                                                        \
+      failures++;                                                                                                                          \
+    }                                                                                                                                      \
+  } while (0)
+
+// Fills in the PVD values of fixture disc i, see fixtures/make_disccache.py
+static ISODiscInfo fixtureDisc(int i) {
+  ISODiscInfo info;
+  memset(&info, 0, sizeof(info));
+  snprintf(info.volumeTimestamp, sizeof(info.volumeTimestamp), "1999%02d%02d120000%02d", i / 28 + 1, i % 28 + 1, i);
+  info.volumeSize = 100000 + i;
+  return info;
+}
+
+static ISODiscInfo newDisc(int i) {
+  ISODiscInfo info;
+  memset(&info, 0, sizeof(info));
+  snprintf(info.volumeTimestamp, sizeof(info.volumeTimestamp), "2004010112000000");
+  info.volumeSize = 200000 + i;
+  return info;
+}
+
+// Returns the disc type, or -ENOENT if the disc is not cached. Checks the cached strings against the expected ones
+static int lookup(ISODiscInfo info, const char *titleID, const char *titleVersion, const char *bootPath) {
+  char cachedBootPath[256] = {0};
+  char cachedTitleID[12] = {0};
+  char cachedTitleVersion[256] = {0};
+
+  int res = discCacheLookup(&info, cachedBootPath, cachedTitleID, cachedTitleVersion);
+  if (res >= 0) {
+    CHECK(!strcmp(cachedTitleID, titleID), "title ID %s != %s", cachedTitleID, titleID);
+    CHECK(!strcmp(cachedTitleVersion, titleVersion), "title version %s != %s", cachedTitleVersion, titleVersion);
+    CHECK(!strcmp(cachedBootPath, bootPath), "boot path %s != %s", cachedBootPath, bootPath);
+  }
+  return res;
+}
+
+static int lookupFixture(int i) {
+  char titleID[12], titleVersion[8], bootPath[32];
+  snprintf(titleID, sizeof(titleID), "SLUS_200.%02d", i);
+  snprintf(titleVersion, sizeof(titleVersion), "1.%02d", i);
+  snprintf(bootPath, sizeof(bootPath), "cdrom0:\\SLUS_200.%02d;1", i);
+  return lookup(fixtureDisc(i), titleID, titleVersion, bootPath);
+}
+
+static long readFile(const char *path, unsigned char *buf, long size) {
+  FILE *f = fopen(path, "rb");
+  if (!f)
+    return -1;
+  long res = fread(buf, 1, size, f);
+  fclose(f);
+  return res;
+}
+
+static void copyFile(const char *from, const char *to) {
+  static unsigned char buf[CACHE_SIZE * 2];
+  long size = readFile(from, buf, sizeof(buf));
+  FILE *f = fopen(to, "wb");
+  if (size < 0 || !f || fwrite(buf, 1, size, f) != (size_t)size) {
+    printf("failed to copy %s to %s\n", from, to);
+    exit(1);
+  }
+  fclose(f);
+}
+
+// Returns the number of bytes that differ between the cache file and buf
+static int diffCache(const unsigned char *buf) {
+  unsigned char current[CACHE_SIZE];
+  CHECK(readFile(CACHE_PATH, current, sizeof(current)) == CACHE_SIZE, "cache file has the wrong size");
+  int diff = 0;
+  for (int i = 0; i < CACHE_SIZE; i++)
+    diff += current[i] != buf[i];
+  return diff;
+}
+
+// Returns 1 if all differences between the cache file and buf are in the header or in the given record
+static int onlyChanged(const unsigned char *buf, int record) {
+  unsigned char current[CACHE_SIZE];
+  readFile(CACHE_PATH, current, sizeof(current));
+  for (int i = CACHE_HEADER_SIZE; i < CACHE_SIZE; i++) {
+    if (current[i] != buf[i] && (i - CACHE_HEADER_SIZE) / CACHE_RECORD_SIZE != record)
+      return 0;
+  }
+  return 1;
+}
+
+int main(int argc, char *argv[]) {
+  unsigned char fixture[CACHE_SIZE];
+  unsigned char saved[CACHE_SIZE];
+  char fixturePath[PATH_MAX];
+  char dir[] = "/tmp/disc_cache_test.XXXXXX";
+
+  if (argc < 2 || !realpath(argv[1], fixturePath)) {
+    printf("usage: %s DISCCACHE.BIN\n", argv[0]);
+    return 1;
+  }
+  if (readFile(fixturePath, fixture, sizeof(fixture)) != CACHE_SIZE) {
+    printf("%s is not %d bytes\n", fixturePath, CACHE_SIZE);
+    return 1;
+  }
+  if (!mkdtemp(dir) || chdir(dir) || mkdir("mc0:", 0755) || mkdir("mc0:/SYS-CONF", 0755)) {
+    printf("failed to set up %s\n", dir);
+    return 1;
+  }
+
+  // Load: every fixture disc is found with its values, other discs are not
+  copyFile(fixturePath, CACHE_PATH);
+  discCacheLoad();
+  for (int i = 0; i < 32; i++)
+    CHECK(lookupFixture(i) == 0x14, "fixture disc %d not found", i);
+  ISODiscInfo unknown = newDisc(0);
+  CHECK(lookup(unknown, "", "", "") == -ENOENT, "unknown disc found");
+  ISODiscInfo noPVD;
+  memset(&noPVD, 0, sizeof(noPVD));
+  CHECK(lookup(noPVD, "", "", "") == -ENOENT, "disc without PVD found");
+
+  // A hit on a recently used disc doesn't write to the card
+  ISODiscInfo recent = fixtureDisc(31);
+  discCacheUpdate(&recent, 0x14, "cdrom0:\\SLUS_200.31;1", "SLUS_200.31", "1.31");
+  discCacheSave();
+  CHECK(diffCache(fixture) == 0, "hit on the most recently used disc changed the cache file");
+  ISODiscInfo halfway = fixtureDisc(32 - 16 + 1);
+  discCacheUpdate(&halfway, 0x14, "cdrom0:\\SLUS_200.17;1", "SLUS_200.17", "1.17");
+  discCacheSave();
+  CHECK(diffCache(fixture) == 0, "hit on a disc in the newer half changed the cache file");
+
+  // A hit on a disc about to be evicted refreshes its record, and only that record
+  ISODiscInfo oldest = fixtureDisc(0);
+  discCacheUpdate(&oldest, 0x14, "cdrom0:\\SLUS_200.00;1", "SLUS_200.00", "1.00");
+  discCacheSave();
+  CHECK(diffCache(fixture) != 0, "hit on the least recently used disc didn't refresh it");
+  CHECK(onlyChanged(fixture, 0), "refreshing record 0 changed other records");
+
+  // A miss evicts the least recently used disc, which is disc 1 now
+  readFile(CACHE_PATH, saved, sizeof(saved));
+  ISODiscInfo added = newDisc(1);
+  discCacheUpdate(&added, 0x12, "cdrom0:\\SLES_500.01;1", "SLES_500.01", "1.10");
+  discCacheSave();
+  CHECK(onlyChanged(saved, 1), "adding a disc changed records other than the evicted one");
+
+  // Everything survives a reload from the card
+  discCacheLoad();
+  CHECK(lookup(added, "SLES_500.01", "1.10", "cdrom0:\\SLES_500.01;1") == 0x12, "added disc not found after reload");
+  CHECK(lookupFixture(1) == -ENOENT, "evicted disc found after reload");
+  CHECK(lookupFixture(0) == 0x14, "refreshed disc not found after reload");
+  for (int i = 2; i < 32; i++)
+    CHECK(lookupFixture(i) == 0x14, "fixture disc %d not found after reload", i);
+
+  // Values too long for a record are not cached
+  ISODiscInfo longPath = newDisc(2);
+  discCacheUpdate(&longPath, 0x14,
+                  "cdrom0:\\A_VERY_LONG_DIRECTORY_NAME\\ANOTHER_VERY_LONG_DIRECTORY_NAME\\SLUS_200.99;1", "SLUS_200.99",
+                  "1.00");
+  CHECK(lookup(longPath, "", "", "") == -ENOENT, "disc with a boot path too long for the record was cached");
+
+  // A cache written with a different title ID table is dropped, then written again as a whole
+  memcpy(saved, fixture, sizeof(saved));
+  saved[16] ^= 0xff;
+  FILE *f = fopen(CACHE_PATH, "wb");
+  fwrite(saved, 1, sizeof(saved), f);
+  fclose(f);
+  discCacheLoad();
+  CHECK(lookupFixture(31) == -ENOENT, "disc found in a cache written with another title ID table");
+  discCacheUpdate(&added, 0x12, "cdrom0:\\SLES_500.01;1", "SLES_500.01", "1.10");
+  discCacheSave();
+  discCacheLoad();
+  CHECK(lookup(added, "SLES_500.01", "1.10", "cdrom0:\\SLES_500.01;1") == 0x12, "disc not found in the rewritten cache");
+  readFile(CACHE_PATH, saved, sizeof(saved));
+  CHECK(!memcmp(saved + 16, fixture + 16, 4), "rewritten cache has the wrong table version");
+
+  // Without a cache file, the whole file is created on save
+  unlink(CACHE_PATH);
+  discCacheLoad();
+  CHECK(lookupFixture(0) == -ENOENT, "disc found without a cache file");
+  discCacheUpdate(&added, 0x12, "cdrom0:\\SLES_500.01;1", "SLES_500.01", "1.10");
+  discCacheSave();
+  struct stat st;
+  CHECK(!stat(CACHE_PATH, &st) && st.st_size == CACHE_SIZE, "new cache file has the wrong size");
+
+  unlink(CACHE_PATH);
+  rmdir("mc0:/SYS-CONF");
+  rmdir("mc0:");
+  rmdir(dir);
+
+  if (failures) {
+    printf("disc_cache_test: %d failures\n", failures);
+    return 1;
+  }
+  printf("disc_cache_test: ok\n");
+  return 0;
+}
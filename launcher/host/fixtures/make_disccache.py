@@ -0,0 +1,34 @@
+#!/usr/bin/env python3
+"""Writes the disc cache fixture used by disc_cache_test.
+
+The cache is full: record i holds disc i, with the volume timestamp
+"1999MMDD120000" + i, a volume size of 100000 + i and title ID
+SLUS_200.<i>. Record i was last used at counter 9 + i, so record 0 is the
+least recently used one and record 31 the most recently used one.
+
+Usage: make_disccache.py game_ids.csv DISCCACHE.BIN
+"""
+import os
+import struct
+import sys
+
+sys.dont_write_bytecode = True
+sys.path.insert(0, os.path.join(os.path.dirname(__file__), "..", "..", "utils"))
+from gen_game_id_table import read_table, table_version  # noqa: E402
+
+CAPACITY = 32
+RECORD = struct.Struct("<16sIIi12s12s76s")
+HEADER = struct.Struct("<4sHHIII")
+
+
+def main():
+    version = table_version(read_table(sys.argv[1]))
+    with open(sys.argv[2], "wb") as f:
+        f.write(HEADER.pack(b"ODCC", 2, RECORD.size, CAPACITY, 9 + CAPACITY - 1, version))
+        for i in range(CAPACITY):
+            f.write(RECORD.pack(b"1999%02d%02d120000%02d" % (i // 28 + 1, i % 28 + 1, i), 100000 + i, 9 + i, 0x14,
+                                b"SLUS_200.%02d" % i, b"1.%02d" % i, b"cdrom0:\\SLUS_200.%02d;1" % i))
+
+
+if __name__ == "__main__":
+    main()
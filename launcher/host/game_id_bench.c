@@ -0,0 +1,83 @@
+// Times getPS1GenericTitleID against the linear scan it replaced, on a table generated by
+// utils/gen_game_id_table.py from synthetic rows
+#include "game_id_table.h"
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Table layout and lookup before the table was generated
+typedef struct {
+  char volumeTimestamp[17];
+  char gameID[12];
+} LinearEntry;
+
+static LinearEntry *linearTable;
+
+static const char *linearLookup(ISODiscInfo *info) {
+  if (info->volumeTimestamp[0] == '\0')
+    return NULL;
+  for (int i = 0; i < gameIDCount; ++i) {
+    if (strncmp(info->volumeTimestamp, linearTable[i].volumeTimestamp, 16) == 0)
+      return linearTable[i].gameID;
+  }
+  return NULL;
+}
+
+static uint64_t nsec() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+int main(int argc, char *argv[]) {
+  int rounds = (argc > 1) ? atoi(argv[1]) : 10;
+  int queryCount = gameIDCount * 2;
+  ISODiscInfo *queries = calloc(queryCount, sizeof(ISODiscInfo));
+  linearTable = calloc(gameIDCount, sizeof(LinearEntry));
+
+  // Every table entry, and as many timestamps that are not in the table
+  for (int i = 0; i < gameIDCount; i++) {
+    snprintf(linearTable[i].volumeTimestamp, sizeof(linearTable[i].volumeTimestamp), "%016llx", (unsigned long long)gameIDTimestamps[i]);
+    memcpy(linearTable[i].gameID, gameIDs[i], GAME_ID_LENGTH);
+    strcpy(queries[i * 2].volumeTimestamp, linearTable[i].volumeTimestamp);
+    snprintf(queries[i * 2 + 1].volumeTimestamp, sizeof(queries[0].volumeTimestamp), "%016llx", (unsigned long long)gameIDTimestamps[i] + 1);
+  }
+
+  // Both lookups must agree
+  int found = 0;
+  for (int i = 0; i < queryCount; i++) {
+    char titleID[GAME_ID_LENGTH + 1];
+    const char *expected = linearLookup(&queries[i]);
+    int res = getPS1GenericTitleID(&queries[i], titleID);
+    if ((res == 0) != (expected != NULL) || (expected && strcmp(titleID, expected))) {
+      printf("mismatch for %s: %s != %s\n", queries[i].volumeTimestamp, res ? "(none)" : titleID, expected ? expected : "(none)");
+      return 1;
+    }
+    found += !res;
+  }
+
+  volatile int sink = 0;
+  uint64_t start = nsec();
+  for (int r = 0; r < rounds; r++) {
+    for (int i = 0; i < queryCount; i++)
+      sink += linearLookup(&queries[i]) != NULL;
+  }
+  uint64_t linear = nsec() - start;
+
+  start = nsec();
+  for (int r = 0; r < rounds; r++) {
+    for (int i = 0; i < queryCount; i++) {
+      char titleID[GAME_ID_LENGTH + 1];
+      sink += getPS1GenericTitleID(&queries[i], titleID) == 0;
+    }
+  }
+  uint64_t binary = nsec() - start;
+
+  uint64_t lookups = (uint64_t)rounds * queryCount;
+  printf("%d entries, %d lookups per round (%d hits), %d rounds\n", gameIDCount, queryCount, found, rounds);
+  printf("linear scan:   %10.1f ns/lookup\n", (double)linear / lookups);
+  printf("binary search: %10.1f ns/lookup (%.0fx faster)\n", (double)binary / lookups, binary ? (double)linear / binary : 0.0);
+  return 0;
+}
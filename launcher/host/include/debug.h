@@ -0,0 +1,2 @@
+// Stands in for the PS2SDK debug.h included by common.h
+#pragma once
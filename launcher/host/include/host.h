@@ -0,0 +1,9 @@
+// Included before every source file built for the host
+#pragma once
+
+#include <fcntl.h>
+#include <stdarg.h>
+
+// The PS2 newlib port has no file permissions, launcher code calls open() with O_CREAT and no mode
+static inline int hostOpen(const char *path, int flags, ...) { return open(path, flags, 0644); }
+#define open(...) hostOpen(__VA_ARGS__)
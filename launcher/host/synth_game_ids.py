@@ -0,0 +1,26 @@
+#!/usr/bin/env python3
+"""Writes a CSV with synthetic PS1 title IDs for game_id_bench.
+
+Usage: synth_game_ids.py COUNT OUTPUT.csv
+"""
+import random
+import sys
+
+
+def main():
+    count = int(sys.argv[1])
+    rng = random.Random(1)
+    timestamps = set()
+    with open(sys.argv[2], "w", encoding="utf-8") as f:
+        f.write("timestamp,game_id,title\n")
+        while len(timestamps) < count:
+            timestamp = "%04d%02d%02d%02d%02d%02d%02d" % (rng.randint(1994, 2006), rng.randint(1, 12), rng.randint(1, 28),
+                                                         rng.randint(0, 23), rng.randint(0, 59), rng.randint(0, 59), rng.randint(0, 99))
+            if timestamp in timestamps:
+                continue
+            timestamps.add(timestamp)
+            f.write("%s,SLUS_%03d.%02d,Synthetic disc %d\n" % (timestamp, len(timestamps) // 100, len(timestamps) % 100, len(timestamps)))
+
+
+if __name__ == "__main__":
+    main()
@@ -24,11 +24,6 @@ typedef enum {
   Device_CDROM = (1 << 9),
 } DeviceType;
 
-typedef enum {
-  PAL_640_512_32,
-  NTSC_640_448_32
-} GSVideoMode;
-
 // A simple linked list for paths and arguments
 typedef struct linkedStr {
   char *str;
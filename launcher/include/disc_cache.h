@@ -0,0 +1,21 @@
+#ifndef _DISC_CACHE_H_
+#define _DISC_CACHE_H_
+
+#include "iso9660.h"
+
+// Reads the disc metadata cache from the memory card
+void discCacheLoad();
+
+// Looks up the disc by its PVD volume creation date and volume size.
+// Copies cached values into bootPath, titleID and titleVersion and returns the disc type or -ENOENT if the disc is not cached
+int discCacheLookup(ISODiscInfo *info, char *bootPath, char *titleID, char *titleVersion);
+
+// Adds the disc to the cache, evicting the least recently used disc if the cache is full.
+// Cached discs are only marked as recently used once they are about to be evicted, so most launches don't write to the memory card.
+// Changes are written to the memory card by discCacheSave
+void discCacheUpdate(ISODiscInfo *info, int discType, const char *bootPath, const char *titleID, const char *titleVersion);
+
+// Writes the changed cache record to the memory card
+void discCacheSave();
+
+#endif
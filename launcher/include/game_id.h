@@ -1,7 +1,11 @@
 #ifndef _GAME_ID_H_
 #define _GAME_ID_H_
 
-// Initializes GS and displays visual game ID
+// Initializes GS and clears the screen.
+// Called early to overlap GS setup with the disc spin-up
+void gsInitGameID();
+
+// Initializes GS if needed and displays visual game ID
 void gsDisplayGameID(const char *gameID);
 
 #endif
@@ -8,6 +8,11 @@
 // Launches ELF from BDM device
 int handleBDM(DeviceType device, int argc, char *argv[]);
 
+// bench.c
+//
+// Measures device initialization and read performance for every path and saves the results to the memory card
+int handleBenchmark(int argc, char *argv[]);
+
 // handler_cdrom.c
 //
 // Launches the disc while displaying the visual game ID and writing to the history file
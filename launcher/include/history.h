@@ -2,7 +2,15 @@
 #ifndef _HISTORY_H_
 #define _HISTORY_H_
 
-// Adds title ID to the history file on both mc0 and mc1
-int updateHistoryFile(const char *titleID);
+// Starts reading history files from both memory cards in a separate thread.
+// Memory card modules must be loaded
+int startHistoryUpdate();
+
+// Passes the title ID to the history thread, which adds it to history files on both mc0 and mc1.
+// NULL or invalid title ID cancels the update. libcdvd must be initialized
+void setHistoryTitleID(const char *titleID);
+
+// Waits for the history thread to finish writing history files
+void waitHistoryUpdate();
 
 #endif
@@ -15,4 +15,7 @@ void applyXPARAM(char *gameID);
 // Initializes IOP modules for given device type
 int initModules(DeviceType device);
 
+// Returns non-zero if memory card modules are loaded for the current device
+int mcModulesLoaded();
+
 #endif
@@ -0,0 +1,28 @@
+#ifndef _ISO9660_H_
+#define _ISO9660_H_
+
+#include <stdint.h>
+
+// Disc metadata read directly from ISO9660 structures
+typedef struct {
+  char volumeTimestamp[17]; // PVD volume creation date as "YYYYMMDDHHMMSScc"
+  uint32_t volumeSize;      // PVD volume space size in sectors
+  char *cnf;                // SYSTEM.CNF contents terminated with '\0' or NULL if the disc has no SYSTEM.CNF
+  int cnfSize;              // SYSTEM.CNF size
+  void *buffer;             // Sector buffer, cnf points into it
+  uint32_t rootLBA;         // Root directory location
+  uint32_t rootSize;        // Root directory size
+} ISODiscInfo;
+
+// Reads the PVD and the sectors following it using a single raw read.
+// libcdvd must be initialized. volumeTimestamp and volumeSize are set if the PVD is valid
+int isoReadVolumeInfo(ISODiscInfo *info);
+
+// Reads SYSTEM.CNF using raw sector reads. Must be called right after isoReadVolumeInfo.
+// Returns 0 if SYSTEM.CNF was read or the root directory doesn't have it
+int isoReadCNF(ISODiscInfo *info);
+
+// Frees the sector buffer
+void isoFreeDiscInfo(ISODiscInfo *info);
+
+#endif
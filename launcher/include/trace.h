@@ -0,0 +1,48 @@
+#ifndef _TRACE_H_
+#define _TRACE_H_
+
+#include <stdint.h>
+
+// Trace event types. Values are stored in the trace file, only append new types
+typedef enum {
+  Trace_Session = 0,    // Start of the flushed session, value is the session number
+  Trace_Overflow,       // Events lost because the ring buffer was full, value is the number of lost events
+  Trace_Start,          // Launcher started, value is argc, str is argv[0]
+  Trace_IOPReset,       // IOP reset done, value is the target device type
+  Trace_ModuleLoad,     // IOP module loaded, value is the result, str is the module name
+  Trace_ModulesReady,   // All modules for the device are loaded, value is the device type
+  Trace_DeviceReady,    // Device became available, value is the result, str is the mountpoint
+  Trace_PathTry,        // Trying to launch the path in str
+  Trace_PathResult,     // Path launch failed, value is the result, str is the path
+  Trace_CNFParse,       // Config file parsed, value is the number of paths, str is the file path
+  Trace_ELFLoadStart,   // Started loading the ELF in str
+  Trace_ELFLoadEnd,     // Loader is ready, executing the ELF in str
+  Trace_DiscType,       // Disc detected, value is the sceCdGetDiskType() result
+  Trace_DiscCNF,        // Disc SYSTEM.CNF parsed, value is the DiscType or the error, str is the title ID
+  Trace_Exec,           // Calling LoadExecPS2 for the ELF in str
+  Trace_Fail,           // Fatal error, str is the start of the message
+  Trace_Flush,          // Trace flush started, value is the number of buffered events
+} TraceEventType;
+
+// Trace record stored in memory and in the trace file
+typedef struct {
+  uint32_t time;  // Time since the first event in microseconds
+  uint16_t type;  // TraceEventType
+  uint16_t index; // Event index within the session
+  int32_t value;  // Event-specific value
+  char str[20];   // Event-specific string, not terminated if it takes the whole field
+} TraceRecord;
+
+#ifdef TRACE
+// Adds an event to the trace ring buffer. Long strings are truncated from the start
+void traceEvent(TraceEventType type, int value, const char *str);
+
+// Appends buffered events to the trace file on the memory card.
+// Does nothing if memory card modules are not loaded
+void traceFlush();
+#else
+#define traceEvent(type, value, str)
+#define traceFlush()
+#endif
+
+#endif
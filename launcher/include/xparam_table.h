@@ -0,0 +1,27 @@
+#ifndef _XPARAM_TABLE_H_
+#define _XPARAM_TABLE_H_
+
+#include <stdint.h>
+
+// Parameter and value written to XPARAM registers
+typedef struct {
+  uint32_t param;
+  uint32_t value;
+} XParamPair;
+
+// Packs the index of the first pair in xparamPairs and the number of pairs into xparamRuns entry
+#define XPARAM_RUN(offset, count) (((offset) << 3) | (count))
+#define XPARAM_RUN_OFFSET(run) ((run) >> 3)
+#define XPARAM_RUN_COUNT(run) ((run) & 0x7)
+// Max number of pairs per title
+#define XPARAM_MAX_PAIRS 7
+
+// XPARAM database, generated from res/xparam.csv by utils/gen_xparam_table.py.
+// Title IDs are stored as 64-bit keys sorted in ascending order: four prefix characters followed by five BCD digits.
+// xparamRuns[i] references the pairs for xparamKeys[i]
+extern const uint64_t xparamKeys[];
+extern const uint16_t xparamRuns[];
+extern const XParamPair xparamPairs[];
+extern const int xparamCount;
+
+#endif
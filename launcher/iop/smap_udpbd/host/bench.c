@@ -0,0 +1,233 @@
+/*
+ * UDPBD client throughput harness
+ *
+ * Runs udpbd.c and ministack.c on top of the emulated IOP in shim.c, against
+ * udpbd_server or any other UDPBD server, and reports throughput, latency
+ * percentiles and the client's own error counters.
+ */
+#include <fcntl.h>
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "main.h"
+#include "shim.h"
+#include "smap_udpbd.h"
+#include "udpbd.h"
+
+
+struct bench_opts
+{
+    const char *server;
+    int port;
+    unsigned int spd_rev;
+    unsigned int cache_kib;
+    unsigned int requests;
+    unsigned int size_kib;
+    int random;
+    unsigned int write_pct;
+    const char *verify;
+    unsigned int seed;
+    unsigned int rx_poll;
+};
+
+static int cmp_u32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+static uint32_t percentile(const uint32_t *sorted, unsigned int count, unsigned int permille)
+{
+    unsigned int i = (uint64_t)count * permille / 1000;
+
+    if (i >= count)
+        i = count - 1;
+    return sorted[i];
+}
+
+static void print_histogram(const char *name, const uint32_t *hist)
+{
+    int i;
+
+    for (i = 0; i < UDPBD_HIST_BUCKETS; i++) {
+        if (hist[i] != 0)
+            printf("  %s %8uus+: %u\n", name, 1U << i, hist[i]);
+    }
+}
+
+// Fills a buffer with data that identifies the sector it was written to
+static void fill_pattern(uint8_t *buf, uint64_t sector, unsigned int count, unsigned int sector_size, unsigned int pass)
+{
+    unsigned int i;
+
+    for (i = 0; i < count * sector_size; i += 4) {
+        uint32_t v = (uint32_t)(sector + i / sector_size) * 2654435761U + i + pass;
+        memcpy(&buf[i], &v, 4);
+    }
+}
+
+static void usage(const char *name)
+{
+    printf("Usage: %s [options]\n"
+           "  -a <address>  server address, default 127.0.0.1\n"
+           "  -p <port>     server port, default %d\n"
+           "  -R <rev>      SPEED revision, <= 0x12 limits DMA blocks to 128 bytes, default 0x13\n"
+           "  -c <KiB>      client sector cache size, default %d\n"
+           "  -n <count>    number of requests, default 1000\n"
+           "  -s <KiB>      request size, default 64\n"
+           "  -r            random instead of sequential requests\n"
+           "  -w <percent>  percentage of requests that are writes\n"
+           "  -f <image>    verify every read against the image the server serves\n"
+           "  -S <seed>     random seed\n"
+           "  -P <polls>    empty Rx polls before falling back to interrupts (rxpoll=), 0 for an interrupt per frame, default 500\n",
+           name, UDPBD_SERVER_PORT, UDPBD_CACHE_DEFAULT_SIZE);
+}
+
+int main(int argc, char *argv[])
+{
+    struct bench_opts o = {"127.0.0.1", UDPBD_SERVER_PORT, 0x13, UDPBD_CACHE_DEFAULT_SIZE, 1000, 64, 0, 0, NULL, 1, 500};
+    struct block_device *bd;
+    struct udpbd_io_stats io;
+    struct udpbd_cache_stats cache;
+    struct smap_link_stats link;
+    struct smap_rx_stats rx;
+    uint32_t *lat;
+    uint8_t *buf, *ref;
+    uint64_t sector = 0, start, elapsed, bytes = 0;
+    unsigned int count, i, errors = 0, mismatches = 0;
+    int verify_fd = -1;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "a:p:R:c:n:s:rw:f:S:P:h")) != -1) {
+        switch (opt) {
+            case 'a': o.server = optarg; break;
+            case 'p': o.port = atoi(optarg); break;
+            case 'R': o.spd_rev = strtol(optarg, NULL, 0); break;
+            case 'c': o.cache_kib = atoi(optarg); break;
+            case 'n': o.requests = atoi(optarg); break;
+            case 's': o.size_kib = atoi(optarg); break;
+            case 'r': o.random = 1; break;
+            case 'w': o.write_pct = atoi(optarg); break;
+            case 'f': o.verify = optarg; break;
+            case 'S': o.seed = atoi(optarg); break;
+            case 'P': o.rx_poll = atoi(optarg); break;
+            default:
+                usage(argv[0]);
+                return 1;
+        }
+    }
+    if (o.requests == 0 || o.size_kib == 0) {
+        usage(argv[0]);
+        return 1;
+    }
+    srand(o.seed);
+
+    if (o.verify != NULL && (verify_fd = open(o.verify, O_RDONLY)) < 0) {
+        perror(o.verify);
+        return 1;
+    }
+
+    udpbd_set_cache_size(o.cache_kib);
+    smap_set_rx_poll_budget(o.rx_poll);
+    udpbd_set_discover_timeout(0);
+    if (shim_start(o.server, o.port, o.spd_rev) < 0)
+        return 1;
+
+    if ((bd = shim_wait_connect(5000)) == NULL) {
+        fprintf(stderr, "no UDPBD server found at %s:%d\n", o.server, o.port);
+        return 1;
+    }
+    shim_devctl(UDPBD_DEVCTL_GET_LINK_STATS, &link, sizeof(link));
+    printf("server: %u sectors of %u bytes, found after %uus\n", (uint32_t)bd->sectorCount, bd->sectorSize, link.discovery_time);
+
+    count = o.size_kib * 1024 / bd->sectorSize;
+    if (count == 0 || count > 0xffff || count > bd->sectorCount) {
+        fprintf(stderr, "invalid request size\n");
+        return 1;
+    }
+
+    lat = malloc(o.requests * sizeof(uint32_t));
+    buf = malloc(count * bd->sectorSize);
+    ref = malloc(count * bd->sectorSize);
+    if (lat == NULL || buf == NULL || ref == NULL)
+        return 1;
+
+    shim_devctl(UDPBD_DEVCTL_RESET_STATS, NULL, 0);
+
+    start = shim_time_usec();
+    for (i = 0; i < o.requests; i++) {
+        int write = o.write_pct != 0 && (unsigned int)(rand() % 100) < o.write_pct;
+        uint64_t t;
+        int result;
+
+        if (o.random)
+            sector = ((uint64_t)rand() << 16 ^ rand()) % (bd->sectorCount - count + 1);
+        else if (sector + count > bd->sectorCount)
+            sector = 0;
+
+        if (write)
+            fill_pattern(buf, sector, count, bd->sectorSize, i);
+
+        t = shim_time_usec();
+        shim_lock();
+        if (write)
+            result = bd->write(bd, sector, buf, count);
+        else
+            result = bd->read(bd, sector, buf, count);
+        shim_unlock();
+        lat[i] = shim_time_usec() - t;
+
+        if (result != (int)count) {
+            errors++;
+            // Too many errors make the client drop the server, wait for it to come back
+            if ((bd = shim_wait_connect(5000)) == NULL) {
+                fprintf(stderr, "server lost after %u requests\n", i);
+                o.requests = i + 1;
+                break;
+            }
+        } else {
+            bytes += count * bd->sectorSize;
+            if (!write && verify_fd >= 0) {
+                memset(ref, 0, count * bd->sectorSize);
+                if (pread(verify_fd, ref, count * bd->sectorSize, sector * bd->sectorSize) < 0 || memcmp(buf, ref, count * bd->sectorSize) != 0) {
+                    if (mismatches++ == 0)
+                        fprintf(stderr, "data mismatch at sector %llu\n", (unsigned long long)sector);
+                }
+            }
+        }
+
+        sector += count;
+    }
+    elapsed = shim_time_usec() - start;
+
+    qsort(lat, o.requests, sizeof(uint32_t), cmp_u32);
+    shim_devctl(UDPBD_DEVCTL_GET_IO_STATS, &io, sizeof(io));
+    shim_devctl(UDPBD_DEVCTL_GET_CACHE_STATS, &cache, sizeof(cache));
+    shim_devctl(UDPBD_DEVCTL_GET_LINK_STATS, &link, sizeof(link));
+    shim_devctl(UDPBD_DEVCTL_GET_RX_STATS, &rx, sizeof(rx));
+
+    printf("%u %s requests of %u KiB, %u%% writes: %u errors", o.requests, o.random ? "random" : "sequential", o.size_kib, o.write_pct, errors);
+    if (verify_fd >= 0)
+        printf(", %u mismatches", mismatches);
+    printf("\n");
+    printf("throughput: %.2f MiB/s (%.1f MiB in %.3f s)\n", elapsed ? (bytes / 1048576.0) / (elapsed / 1000000.0) : 0.0, bytes / 1048576.0,
+           elapsed / 1000000.0);
+    printf("latency: p50 %uus, p90 %uus, p99 %uus, p99.9 %uus, max %uus\n", percentile(lat, o.requests, 500), percentile(lat, o.requests, 900),
+           percentile(lat, o.requests, 990), percentile(lat, o.requests, 999), lat[o.requests - 1]);
+    printf("client: %u reads, %u writes, %u retries, %u timeouts, %u out of order, %u bad size, %u DMA errors, %u write errors, %u stale, %u duplicates, %u disconnects\n",
+           io.reads, io.writes, io.retries, io.timeouts, io.bad_cmdpkt, io.bad_size, io.dma_errors, io.write_errors, io.stale, io.duplicates, io.disconnects);
+    printf("rx: %u frames, %u interrupts, %u polled, %.1f interrupts/MiB\n", rx.frames, rx.interrupts, rx.polled,
+           bytes ? rx.interrupts / (bytes / 1048576.0) : 0.0);
+    if (link.rdma_block_size != 0)
+        printf("rdma: %u byte blocks, calibrated in %uus, set again %u times\n", link.rdma_block_size, link.calibration_time, io.geometry_resends);
+    printf("cache: %u hits, %u misses, %u prefetched, %u evictions\n", cache.hits, cache.misses, cache.prefetched, cache.evictions);
+    print_histogram("read ", io.read_hist);
+    print_histogram("write", io.write_hist);
+
+    return (errors != 0 || mismatches != 0) ? 2 : 0;
+}
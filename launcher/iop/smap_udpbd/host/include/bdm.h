@@ -0,0 +1 @@
+#include "ps2shim.h"
@@ -0,0 +1,148 @@
+#ifndef PS2SHIM_H
+#define PS2SHIM_H
+
+/*
+ * Just enough of the IOP kernel, DEV9 and SMAP interfaces to run the
+ * UDPBD client (udpbd.c + ministack.c) as a Linux process.
+ * Implemented in shim.c, every PS2SDK header the client includes maps to this one.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdlib.h>
+
+
+typedef uint8_t  u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef uint64_t u64;
+typedef int64_t  s64;
+
+/*
+ * thbase / thevent
+ */
+typedef struct
+{
+    u32 lo;
+    u32 hi;
+} iop_sys_clock_t;
+
+typedef struct
+{
+    u32 attr;
+    u32 option;
+    u32 bits;
+} iop_event_t;
+
+#define WEF_AND   0x00
+#define WEF_OR    0x01
+#define WEF_CLEAR 0x10
+
+int DelayThread(int usec);
+int GetThreadId(void);
+int SetAlarm(iop_sys_clock_t *clock, unsigned int (*cb)(void *), void *arg);
+int CancelAlarm(unsigned int (*cb)(void *), void *arg);
+void USec2SysClock(u32 usec, iop_sys_clock_t *clock);
+void SysClock2USec(iop_sys_clock_t *clock, u32 *sec, u32 *usec);
+
+int CreateEventFlag(iop_event_t *event);
+int SetEventFlag(int ef, u32 bits);
+int iSetEventFlag(int ef, u32 bits);
+int ClearEventFlag(int ef, u32 bits);
+int WaitEventFlag(int ef, u32 bits, int mode, u32 *resbits);
+
+/*
+ * sysmem
+ */
+#define ALLOC_FIRST 0
+void *AllocSysMemory(int mode, int size, void *ptr);
+int FreeSysMemory(void *ptr);
+
+/*
+ * iomanX
+ */
+#define IOP_DT_FS    0x10
+#define IOP_DT_FSEXT 0x10000000
+
+struct _iop_device;
+typedef struct
+{
+    int mode;
+    int unit;
+    struct _iop_device *device;
+    void *privdata;
+} iop_file_t;
+
+// Only devctl is ever called, the other operations are kept untyped
+typedef struct
+{
+    void *init, *deinit, *format, *open, *close, *read, *write, *lseek, *ioctl;
+    void *remove, *mkdir, *rmdir, *dopen, *dclose, *dread, *getstat, *chstat;
+    void *rename, *chdir, *sync, *mount, *umount, *lseek64;
+    int (*devctl)(iop_file_t *f, const char *name, int cmd, void *arg, unsigned int arglen, void *buf, unsigned int buflen);
+    void *symlink, *readlink, *ioctl2;
+} iop_device_ops_t;
+
+typedef struct _iop_device
+{
+    const char *name;
+    unsigned int type;
+    unsigned int version;
+    const char *desc;
+    iop_device_ops_t *ops;
+} iop_device_t;
+
+int AddDrv(iop_device_t *device);
+int DelDrv(const char *name);
+
+/*
+ * bdm
+ */
+struct block_device
+{
+    void *priv;
+    char *name;
+    unsigned int devNr;
+    unsigned int parNr;
+    unsigned char parId;
+    unsigned int sectorSize;
+    unsigned int sectorOffset;
+    u64 sectorCount;
+    int (*read)(struct block_device *bd, u64 sector, void *buffer, u16 count);
+    int (*write)(struct block_device *bd, u64 sector, const void *buffer, u16 count);
+    void (*flush)(struct block_device *bd);
+    int (*stop)(struct block_device *bd);
+};
+
+void bdm_connect_bd(struct block_device *bd);
+void bdm_disconnect_bd(struct block_device *bd);
+
+/*
+ * dmacman / dev9
+ */
+#define DMAC_FROM_MEM 1
+#define DMAC_TO_MEM   0
+
+int dev9DmaTransfer(int ctrl, void *addr, int bcr, int dir);
+
+/*
+ * SPEED / SMAP registers
+ * Only the Rx FIFO is emulated: a received frame is placed at FIFO address 0,
+ * SMAP_R_RXFIFO_RD_PTR seeks in it and SMAP_R_RXFIFO_DATA reads the next word.
+ */
+#define SPD_R_REV_1           0x02
+#define SMAP_R_RXFIFO_RD_PTR  0x1034
+#define SMAP_R_RXFIFO_DATA    0x1200
+
+volatile u16 *shim_reg16(unsigned int reg);
+volatile u32 *shim_reg32(unsigned int reg);
+
+#define USE_SPD_REGS
+#define USE_SMAP_REGS
+#define SPD_REG16(reg)  (*shim_reg16(reg))
+#define SMAP_REG16(reg) (*shim_reg16(reg))
+#define SMAP_REG32(reg) (*shim_reg32(reg))
+
+
+#endif
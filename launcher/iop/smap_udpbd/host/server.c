@@ -0,0 +1,512 @@
+/*
+ * UDPBD v2 server for Linux
+ *
+ * Serves a disk image to the smap_udpbd module, or to udpbd_bench.
+ * Supports INFO negotiation, HINT, and can impair its traffic with packet
+ * loss, reordering, duplication and latency to exercise the client's error
+ * handling.
+ */
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <getopt.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include "udpbd.h"
+
+
+#define SERVER_FEATURES    (UDPBD_FEATURE_HINT | UDPBD_FEATURE_SECTOR_SIZE | UDPBD_FEATURE_LARGE_XFER | UDPBD_FEATURE_GEOMETRY)
+#define SERVER_MAX_XFER    (1024 * 1024) // Bytes per request with UDPBD_FEATURE_LARGE_XFER
+#define SERVER_BUFFER_SIZE (UDPBD_MAX_SECTOR_READ * 4096 > SERVER_MAX_XFER ? UDPBD_MAX_SECTOR_READ * 4096 : SERVER_MAX_XFER)
+
+struct impair
+{
+    unsigned int loss;    // Percentage of packets dropped, in both directions
+    unsigned int reorder; // Percentage of sent packets swapped with the next one
+    unsigned int dup;     // Percentage of sent packets sent twice
+    unsigned int delay;   // Microseconds before each reply
+    unsigned int jitter;  // Random extra microseconds before each reply
+    unsigned int mbit;    // Wire speed sent packets are paced to, 0 = as fast as possible
+};
+
+struct server_stats
+{
+    unsigned long rx, tx;
+    unsigned long reads, writes, hints, infos, geometries;
+    unsigned long dropped, reordered, duplicated;
+    unsigned long long bytes_read, bytes_written;
+};
+
+static int sock = -1;
+static int image = -1;
+static off_t image_size;
+static unsigned int sector_size = 512;
+static unsigned int block_shift = 5; // 128 byte RDMA blocks
+static unsigned int block_count = 0; // RDMA blocks per packet, 0 = as many as fit
+static int no_geometry = 0;          // Ignore UDPBD_CMD_GEOMETRY
+static int legacy = 0;               // Behave like a server that does not negotiate
+static int verbose = 0;
+static struct impair impair;
+static struct server_stats stats;
+static uint8_t *buffer;
+
+static uint8_t held[2048]; // Packet held back to be reordered
+static size_t held_size = 0;
+static struct sockaddr_in held_addr;
+
+static volatile sig_atomic_t quit = 0;
+
+
+static int chance(unsigned int percent)
+{
+    return percent != 0 && (unsigned int)(rand() % 100) < percent;
+}
+
+static uint64_t time_nsec(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// Waits until the previous packet would have left an Ethernet link of impair.mbit
+static void net_pace(size_t size)
+{
+    static uint64_t next = 0;
+    uint64_t now = time_nsec();
+
+    if (impair.mbit == 0)
+        return;
+
+    // Ethernet, IP and UDP headers, FCS, preamble and inter-frame gap
+    size += 14 + 20 + 8 + 4 + 8 + 12;
+    if (next < now)
+        next = now;
+    while (time_nsec() < next) {}
+    next += size * 8 * 1000 / impair.mbit;
+}
+
+static void net_send_now(const void *buf, size_t size, const struct sockaddr_in *to)
+{
+    net_pace(size);
+    if (sendto(sock, buf, size, 0, (const struct sockaddr *)to, sizeof(*to)) < 0)
+        perror("sendto");
+    stats.tx++;
+}
+
+static void net_flush(void)
+{
+    if (held_size != 0) {
+        net_send_now(held, held_size, &held_addr);
+        held_size = 0;
+    }
+}
+
+// Send a packet through the impairments
+static void net_send(const void *buf, size_t size, const struct sockaddr_in *to)
+{
+    if (chance(impair.loss)) {
+        stats.dropped++;
+        return;
+    }
+
+    if (held_size == 0 && chance(impair.reorder) && size <= sizeof(held)) {
+        memcpy(held, buf, size);
+        held_size = size;
+        held_addr = *to;
+        stats.reordered++;
+        return;
+    }
+
+    net_send_now(buf, size, to);
+    if (chance(impair.dup)) {
+        net_send_now(buf, size, to);
+        stats.duplicated++;
+    }
+    net_flush();
+}
+
+static void reply_delay(void)
+{
+    unsigned int usec = impair.delay;
+
+    if (impair.jitter != 0)
+        usec += rand() % impair.jitter;
+    if (usec != 0)
+        usleep(usec);
+}
+
+static uint64_t sector_count(void)
+{
+    return image_size / sector_size;
+}
+
+static void cmd_info(const uint8_t *pkt, size_t size, const struct sockaddr_in *from)
+{
+    struct SUDPBDv2_InfoRequest req;
+    struct SUDPBDv2_InfoReply reply;
+    size_t reply_size = 2 + 4 + 4; // Header, sector size and count only
+
+    memset(&req, 0, sizeof(req));
+    memcpy(&req, pkt, size < sizeof(req) ? size : sizeof(req));
+
+    memset(&reply, 0, sizeof(reply));
+    reply.hdr.cmd    = UDPBD_CMD_INFO_REPLY;
+    reply.hdr.cmdid  = req.hdr.cmdid;
+    reply.hdr.cmdpkt = 1;
+
+    if (!legacy && size >= sizeof(req) && req.version >= 1) {
+        reply.features = req.features & SERVER_FEATURES;
+        if (no_geometry)
+            reply.features &= ~UDPBD_FEATURE_GEOMETRY;
+
+        // Present the sector size the client prefers, if the image allows it
+        if ((reply.features & UDPBD_FEATURE_SECTOR_SIZE) && req.sector_size >= 512 && req.sector_size <= 4096 &&
+            (req.sector_size & (req.sector_size - 1)) == 0 && (image_size % req.sector_size) == 0)
+            sector_size = req.sector_size;
+
+        reply.version     = UDPBD_VERSION;
+        reply.max_sectors = (reply.features & UDPBD_FEATURE_LARGE_XFER) ? SERVER_MAX_XFER / sector_size : 0;
+        reply_size        = sizeof(reply);
+    } else
+        sector_size = 512;
+
+    reply.sector_size  = sector_size;
+    reply.sector_count = sector_count();
+
+    if (verbose)
+        printf("INFO from %s: %u byte sectors, features 0x%x\n", inet_ntoa(from->sin_addr), sector_size, reply.features);
+    stats.infos++;
+
+    reply_delay();
+    net_send(&reply, reply_size, from);
+}
+
+static void cmd_read(const uint8_t *pkt, const struct sockaddr_in *from)
+{
+    struct SUDPBDv2_RWRequest req;
+    struct SUDPBDv2_RDMA rdma;
+    unsigned int block_size = 1U << (block_shift + 2);
+    unsigned int max_blocks = RDMA_MAX_PAYLOAD / block_size;
+    size_t size, offset;
+    ssize_t result;
+    uint8_t cmdpkt = 1;
+
+    memcpy(&req, pkt, sizeof(req));
+    if (block_count != 0 && block_count < max_blocks)
+        max_blocks = block_count;
+    size = (size_t)req.sector_count * sector_size;
+    if (size > SERVER_BUFFER_SIZE) {
+        fprintf(stderr, "READ of %u sectors is too big\n", req.sector_count);
+        return;
+    }
+
+    // Read past the end of the image as zeros
+    memset(buffer, 0, size);
+    result = pread(image, buffer, size, (off_t)req.sector_nr * sector_size);
+    if (result < 0)
+        perror("pread");
+
+    if (verbose > 1)
+        printf("READ %u + %u\n", req.sector_nr, req.sector_count);
+    stats.reads++;
+    stats.bytes_read += size;
+
+    reply_delay();
+
+    rdma.hdr.cmd   = UDPBD_CMD_READ_RDMA;
+    rdma.hdr.cmdid = req.hdr.cmdid;
+    rdma.bt.bt     = 0;
+    rdma.bt.block_shift = block_shift;
+    for (offset = 0; offset < size;) {
+        unsigned int blocks = (size - offset) / block_size;
+        unsigned int chunk;
+
+        if (blocks > max_blocks)
+            blocks = max_blocks;
+        chunk = blocks * block_size;
+
+        rdma.hdr.cmdpkt     = cmdpkt++;
+        rdma.bt.block_count = blocks;
+        memcpy(rdma.data, &buffer[offset], chunk);
+        net_send(&rdma, 2 + 4 + chunk, from);
+        offset += chunk;
+    }
+    net_flush();
+}
+
+static struct
+{
+    int active;
+    uint8_t cmdid;
+    uint32_t sector_nr;
+    size_t size;
+    size_t received;
+} write_req;
+
+static void cmd_write(const uint8_t *pkt)
+{
+    struct SUDPBDv2_RWRequest req;
+
+    memcpy(&req, pkt, sizeof(req));
+    write_req.active    = 1;
+    write_req.cmdid     = req.hdr.cmdid;
+    write_req.sector_nr = req.sector_nr;
+    write_req.size      = (size_t)req.sector_count * sector_size;
+    write_req.received  = 0;
+    if (write_req.size > SERVER_BUFFER_SIZE) {
+        fprintf(stderr, "WRITE of %u sectors is too big\n", req.sector_count);
+        write_req.active = 0;
+    }
+
+    if (verbose > 1)
+        printf("WRITE %u + %u\n", req.sector_nr, req.sector_count);
+    stats.writes++;
+}
+
+static void cmd_write_rdma(const uint8_t *pkt, size_t size, const struct sockaddr_in *from)
+{
+    struct SUDPBDv2_Header hdr;
+    union block_type bt;
+    struct SUDPBDv2_WriteDone done;
+    size_t chunk;
+
+    memcpy(&hdr, pkt, sizeof(hdr));
+    memcpy(&bt, &pkt[2], sizeof(bt));
+    chunk = (size_t)bt.block_count << (bt.block_shift + 2);
+
+    if (!write_req.active || hdr.cmdid != write_req.cmdid)
+        return;
+    if (chunk > size - 6 || write_req.received + chunk > write_req.size) {
+        fprintf(stderr, "WRITE_RDMA with invalid size %zu\n", chunk);
+        return;
+    }
+
+    memcpy(&buffer[write_req.received], &pkt[6], chunk);
+    write_req.received += chunk;
+    if (write_req.received < write_req.size)
+        return;
+
+    write_req.active = 0;
+    memset(&done, 0, sizeof(done));
+    done.hdr.cmd    = UDPBD_CMD_WRITE_DONE;
+    done.hdr.cmdid  = write_req.cmdid;
+    done.hdr.cmdpkt = 1;
+    done.result     = 0;
+    if (pwrite(image, buffer, write_req.size, (off_t)write_req.sector_nr * sector_size) != (ssize_t)write_req.size) {
+        perror("pwrite");
+        done.result = -EIO;
+    }
+    stats.bytes_written += write_req.size;
+
+    reply_delay();
+    net_send(&done, sizeof(done), from);
+}
+
+static void cmd_hint(const uint8_t *pkt)
+{
+    struct SUDPBDv2_Hint hint;
+    off_t offset;
+    off_t len;
+
+    memcpy(&hint, pkt, sizeof(hint));
+    offset = (off_t)hint.sector_nr * sector_size;
+    len    = (off_t)hint.sector_count * sector_size;
+
+    switch (hint.pattern) {
+        case UDPBD_HINT_SEQUENTIAL:
+            posix_fadvise(image, offset, len, POSIX_FADV_SEQUENTIAL);
+            posix_fadvise(image, offset, len, POSIX_FADV_WILLNEED);
+            break;
+        case UDPBD_HINT_RANDOM:
+            posix_fadvise(image, 0, 0, POSIX_FADV_RANDOM);
+            break;
+        case UDPBD_HINT_WILLNEED:
+            posix_fadvise(image, offset, len, POSIX_FADV_WILLNEED);
+            break;
+    }
+
+    if (verbose > 1)
+        printf("HINT %u + %u, pattern %u\n", hint.sector_nr, hint.sector_count, hint.pattern);
+    stats.hints++;
+}
+
+static void cmd_geometry(const uint8_t *pkt, const struct sockaddr_in *from)
+{
+    struct SUDPBDv2_Geometry geo;
+
+    memcpy(&geo, pkt, sizeof(geo));
+    if (geo.block_shift > 7 || (geo.block_count << (geo.block_shift + 2)) > RDMA_MAX_PAYLOAD) {
+        fprintf(stderr, "invalid geometry %u x %u\n", geo.block_count, 4U << geo.block_shift);
+    } else {
+        block_shift = geo.block_shift;
+        block_count = geo.block_count;
+
+        if (verbose)
+            printf("GEOMETRY %u byte blocks, %u per packet\n", 4U << block_shift, block_count);
+        stats.geometries++;
+    }
+
+    // Confirm the geometry in use, the client retries until it matches what it asked for
+    geo.hdr.cmd     = UDPBD_CMD_GEOMETRY_ACK;
+    geo.hdr.cmdpkt  = 1;
+    geo.block_shift = block_shift;
+    geo.block_count = block_count;
+    net_send(&geo, sizeof(geo), from);
+}
+
+static void on_signal(int sig)
+{
+    quit = 1;
+}
+
+static void usage(const char *name)
+{
+    printf("Usage: %s [options] <image>\n"
+           "  -p <port>     UDP port, default %d\n"
+           "  -b <shift>    RDMA block shift, block size is 4 << shift bytes, default 5 (128 bytes)\n"
+           "  -L            legacy server, do not negotiate (512 byte sectors, no features)\n"
+           "  -G            ignore RDMA geometry requests from the client\n"
+           "  -l <percent>  drop packets, in both directions\n"
+           "  -r <percent>  swap sent packets with the next one\n"
+           "  -u <percent>  send packets twice\n"
+           "  -d <usec>     delay every reply\n"
+           "  -j <usec>     add up to this much random delay to every reply\n"
+           "  -m <Mbit/s>   pace sent packets to this wire speed\n"
+           "  -S <seed>     random seed for the impairments\n"
+           "  -v            verbose, repeat to log every command\n",
+           name, UDPBD_SERVER_PORT);
+}
+
+int main(int argc, char *argv[])
+{
+    struct sockaddr_in addr;
+    struct stat st;
+    struct sigaction sa;
+    unsigned int seed = 1;
+    int port = UDPBD_SERVER_PORT;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "p:b:LGl:r:u:d:j:m:S:vh")) != -1) {
+        switch (opt) {
+            case 'p': port = atoi(optarg); break;
+            case 'b': block_shift = atoi(optarg); break;
+            case 'L': legacy = 1; break;
+            case 'G': no_geometry = 1; break;
+            case 'l': impair.loss = atoi(optarg); break;
+            case 'r': impair.reorder = atoi(optarg); break;
+            case 'u': impair.dup = atoi(optarg); break;
+            case 'd': impair.delay = atoi(optarg); break;
+            case 'j': impair.jitter = atoi(optarg); break;
+            case 'm': impair.mbit = atoi(optarg); break;
+            case 'S': seed = atoi(optarg); break;
+            case 'v': verbose++; break;
+            default:
+                usage(argv[0]);
+                return 1;
+        }
+    }
+    if (optind >= argc || block_shift > 7) {
+        usage(argv[0]);
+        return 1;
+    }
+    srand(seed);
+
+    if ((image = open(argv[optind], O_RDWR)) < 0 || fstat(image, &st) < 0) {
+        perror(argv[optind]);
+        return 1;
+    }
+    image_size = st.st_size;
+
+    if ((buffer = malloc(SERVER_BUFFER_SIZE)) == NULL)
+        return 1;
+
+    if ((sock = socket(AF_INET, SOCK_DGRAM, 0)) < 0) {
+        perror("socket");
+        return 1;
+    }
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family      = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port        = htons(port);
+    if (bind(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+        perror("bind");
+        return 1;
+    }
+
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = on_signal;
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+
+    printf("Serving %s on port %d, %lld bytes\n", argv[optind], port, (long long)image_size);
+
+    while (!quit) {
+        uint8_t pkt[2048];
+        struct sockaddr_in from;
+        socklen_t fromlen = sizeof(from);
+        struct SUDPBDv2_Header hdr;
+        ssize_t size;
+
+        size = recvfrom(sock, pkt, sizeof(pkt), 0, (struct sockaddr *)&from, &fromlen);
+        if (size < 0) {
+            if (errno != EINTR)
+                perror("recvfrom");
+            continue;
+        }
+        if (size < (ssize_t)sizeof(hdr))
+            continue;
+        stats.rx++;
+
+        if (chance(impair.loss)) {
+            stats.dropped++;
+            continue;
+        }
+
+        memcpy(&hdr, pkt, sizeof(hdr));
+        switch (hdr.cmd) {
+            case UDPBD_CMD_INFO:
+                cmd_info(pkt, size, &from);
+                break;
+            case UDPBD_CMD_READ:
+                if (size >= (ssize_t)sizeof(struct SUDPBDv2_RWRequest))
+                    cmd_read(pkt, &from);
+                break;
+            case UDPBD_CMD_WRITE:
+                if (size >= (ssize_t)sizeof(struct SUDPBDv2_RWRequest))
+                    cmd_write(pkt);
+                break;
+            case UDPBD_CMD_WRITE_RDMA:
+                if (size >= 6)
+                    cmd_write_rdma(pkt, size, &from);
+                break;
+            case UDPBD_CMD_HINT:
+                if (!legacy && size >= (ssize_t)sizeof(struct SUDPBDv2_Hint))
+                    cmd_hint(pkt);
+                break;
+            case UDPBD_CMD_GEOMETRY:
+                if (!legacy && !no_geometry && size >= (ssize_t)sizeof(struct SUDPBDv2_Geometry))
+                    cmd_geometry(pkt, &from);
+                break;
+            default:
+                if (verbose)
+                    printf("unknown command %d\n", hdr.cmd);
+        }
+    }
+
+    printf("rx %lu, tx %lu packets: %lu info, %lu reads (%llu bytes), %lu writes (%llu bytes), %lu hints, %lu geometries\n", stats.rx, stats.tx,
+           stats.infos, stats.reads, stats.bytes_read, stats.writes, stats.bytes_written, stats.hints, stats.geometries);
+    printf("impaired: %lu dropped, %lu reordered, %lu duplicated\n", stats.dropped, stats.reordered, stats.duplicated);
+
+    return 0;
+}
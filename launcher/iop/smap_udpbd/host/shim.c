@@ -0,0 +1,567 @@
+/*
+ * Emulated IOP environment for the UDPBD client
+ *
+ * The IOP runs one thread at a time, so the client code is not written to be
+ * thread safe. All emulated threads and alarms share one big lock, and only
+ * release it while blocked (WaitEventFlag, DelayThread).
+ *
+ * Frames from the client are sent to the server as plain UDP datagrams, and
+ * datagrams from the server are turned back into ethernet frames in an
+ * emulated Rx FIFO, where handle_rx_eth() picks them up like on the console.
+ */
+#include <errno.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include "shim.h"
+#include "main.h"
+#include "xfer.h"
+#include "udpbd.h"
+
+// ministack.h can not be included next to the socket headers, both define htons
+int handle_rx_eth(uint16_t pointer);
+uint32_t ms_ip_get_ip(void);
+
+#define SHIM_MAX_EVENTS 8
+#define SHIM_MAX_ALARMS 16
+#define SHIM_FIFO_SIZE  16384
+
+struct shim_event
+{
+    int used;
+    u32 bits;
+    pthread_cond_t cond;
+};
+
+struct shim_alarm
+{
+    int used;
+    uint64_t due;
+    unsigned int (*cb)(void *);
+    void *arg;
+};
+
+struct SmapDriverData SmapDriverData;
+struct smap_link_stats smap_link_stats;
+struct smap_rx_stats smap_rx_stats;
+struct smap_tx_stats smap_tx_stats;
+
+static pthread_mutex_t big_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct shim_event events[SHIM_MAX_EVENTS];
+static struct shim_alarm alarms[SHIM_MAX_ALARMS];
+static pthread_cond_t alarm_cond;
+static pthread_cond_t connect_cond;
+
+static int sock = -1;
+static struct sockaddr_in server_addr;
+static struct block_device *connected_bd = NULL;
+static iop_device_t *stats_dev = NULL;
+
+static uint8_t rx_fifo[SHIM_FIFO_SIZE] __attribute__((aligned(4)));
+static u16 rx_rd_ptr;
+static u16 spd_rev;
+static u16 reg16_dummy;
+static u32 reg32_dummy;
+
+static const uint8_t client_mac[6] = {0x00, 0x04, 0x1f, 0x00, 0x00, 0x01};
+static const uint8_t server_mac[6] = {0x02, 0x00, 0x00, 0x00, 0x00, 0x02};
+
+
+uint64_t shim_time_usec(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static void shim_abstime(struct timespec *ts, uint64_t usec)
+{
+    ts->tv_sec  = usec / 1000000;
+    ts->tv_nsec = (usec % 1000000) * 1000;
+}
+
+static void shim_cond_init(pthread_cond_t *cond)
+{
+    pthread_condattr_t attr;
+
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(cond, &attr);
+    pthread_condattr_destroy(&attr);
+}
+
+void shim_lock(void)
+{
+    pthread_mutex_lock(&big_lock);
+}
+
+void shim_unlock(void)
+{
+    pthread_mutex_unlock(&big_lock);
+}
+
+//
+// thbase
+//
+int DelayThread(int usec)
+{
+    shim_unlock();
+    usleep(usec);
+    shim_lock();
+    return 0;
+}
+
+int GetThreadId(void)
+{
+    return 1;
+}
+
+void USec2SysClock(u32 usec, iop_sys_clock_t *clock)
+{
+    // One tick per microsecond
+    clock->lo = usec;
+    clock->hi = 0;
+}
+
+void SysClock2USec(iop_sys_clock_t *clock, u32 *sec, u32 *usec)
+{
+    *sec  = clock->lo / 1000000;
+    *usec = clock->lo % 1000000;
+}
+
+int SetAlarm(iop_sys_clock_t *clock, unsigned int (*cb)(void *), void *arg)
+{
+    int i;
+
+    for (i = 0; i < SHIM_MAX_ALARMS; i++) {
+        if (!alarms[i].used) {
+            alarms[i].used = 1;
+            alarms[i].due  = shim_time_usec() + clock->lo;
+            alarms[i].cb   = cb;
+            alarms[i].arg  = arg;
+            pthread_cond_signal(&alarm_cond);
+            return 0;
+        }
+    }
+
+    return -1;
+}
+
+int CancelAlarm(unsigned int (*cb)(void *), void *arg)
+{
+    int i;
+
+    for (i = 0; i < SHIM_MAX_ALARMS; i++) {
+        if (alarms[i].used && alarms[i].cb == cb && alarms[i].arg == arg) {
+            alarms[i].used = 0;
+            return 0;
+        }
+    }
+
+    return -1;
+}
+
+// Alarm handlers run with the big lock held, like in interrupt context
+static void *alarm_thread(void *arg)
+{
+    shim_lock();
+    while (1) {
+        struct shim_alarm *next = NULL;
+        uint64_t now;
+        int i;
+
+        for (i = 0; i < SHIM_MAX_ALARMS; i++) {
+            if (alarms[i].used && (next == NULL || alarms[i].due < next->due))
+                next = &alarms[i];
+        }
+
+        if (next == NULL) {
+            pthread_cond_wait(&alarm_cond, &big_lock);
+            continue;
+        }
+
+        now = shim_time_usec();
+        if (next->due > now) {
+            struct timespec ts;
+
+            shim_abstime(&ts, next->due);
+            pthread_cond_timedwait(&alarm_cond, &big_lock, &ts);
+            continue;
+        }
+
+        {
+            unsigned int ticks = next->cb(next->arg);
+
+            // A handler returning non-zero is rescheduled, unless it was cancelled meanwhile
+            if (next->used && ticks != 0)
+                next->due = now + ticks;
+            else
+                next->used = 0;
+        }
+    }
+
+    return NULL;
+}
+
+//
+// thevent
+//
+int CreateEventFlag(iop_event_t *event)
+{
+    int i;
+
+    for (i = 0; i < SHIM_MAX_EVENTS; i++) {
+        if (!events[i].used) {
+            events[i].used = 1;
+            events[i].bits = event->bits;
+            pthread_cond_init(&events[i].cond, NULL);
+            return i + 1;
+        }
+    }
+
+    return -1;
+}
+
+int SetEventFlag(int ef, u32 bits)
+{
+    events[ef - 1].bits |= bits;
+    pthread_cond_broadcast(&events[ef - 1].cond);
+    return 0;
+}
+
+int iSetEventFlag(int ef, u32 bits)
+{
+    return SetEventFlag(ef, bits);
+}
+
+int ClearEventFlag(int ef, u32 bits)
+{
+    events[ef - 1].bits &= bits;
+    return 0;
+}
+
+int WaitEventFlag(int ef, u32 bits, int mode, u32 *resbits)
+{
+    struct shim_event *ev = &events[ef - 1];
+
+    while ((mode & WEF_OR) ? !(ev->bits & bits) : ((ev->bits & bits) != bits))
+        pthread_cond_wait(&ev->cond, &big_lock);
+
+    if (resbits != NULL)
+        *resbits = ev->bits;
+    if (mode & WEF_CLEAR)
+        ev->bits &= ~bits;
+
+    return 0;
+}
+
+//
+// sysmem, iomanX, bdm
+//
+void *AllocSysMemory(int mode, int size, void *ptr)
+{
+    return malloc(size);
+}
+
+int FreeSysMemory(void *ptr)
+{
+    free(ptr);
+    return 0;
+}
+
+int AddDrv(iop_device_t *device)
+{
+    stats_dev = device;
+    return 0;
+}
+
+int DelDrv(const char *name)
+{
+    return 0;
+}
+
+int shim_devctl(int cmd, void *buf, unsigned int buflen)
+{
+    int result;
+
+    if (stats_dev == NULL)
+        return -ENODEV;
+
+    shim_lock();
+    result = stats_dev->ops->devctl(NULL, "", cmd, NULL, 0, buf, buflen);
+    shim_unlock();
+
+    return result;
+}
+
+void bdm_connect_bd(struct block_device *bd)
+{
+    connected_bd = bd;
+    pthread_cond_broadcast(&connect_cond);
+}
+
+void bdm_disconnect_bd(struct block_device *bd)
+{
+    connected_bd = NULL;
+}
+
+struct block_device *shim_wait_connect(unsigned int timeout_ms)
+{
+    struct block_device *bd;
+    struct timespec ts;
+
+    shim_abstime(&ts, shim_time_usec() + (uint64_t)timeout_ms * 1000);
+
+    shim_lock();
+    while (connected_bd == NULL) {
+        if (pthread_cond_timedwait(&connect_cond, &big_lock, &ts) == ETIMEDOUT)
+            break;
+    }
+    bd = connected_bd;
+    shim_unlock();
+
+    return bd;
+}
+
+//
+// DEV9 / SMAP
+//
+volatile u16 *shim_reg16(unsigned int reg)
+{
+    switch (reg) {
+        case SMAP_R_RXFIFO_RD_PTR:
+            return &rx_rd_ptr;
+        case SPD_R_REV_1:
+            return &spd_rev;
+        default:
+            return &reg16_dummy;
+    }
+}
+
+volatile u32 *shim_reg32(unsigned int reg)
+{
+    static u32 data;
+
+    if (reg != SMAP_R_RXFIFO_DATA)
+        return &reg32_dummy;
+
+    memcpy(&data, &rx_fifo[rx_rd_ptr % SHIM_FIFO_SIZE], 4);
+    rx_rd_ptr += 4;
+    return &data;
+}
+
+int dev9DmaTransfer(int ctrl, void *addr, int bcr, int dir)
+{
+    unsigned int size = (bcr >> 16) * (bcr & 0xffff) * 4;
+
+    if (dir != DMAC_TO_MEM || (rx_rd_ptr + size) > SHIM_FIFO_SIZE)
+        return -1;
+
+    memcpy(addr, &rx_fifo[rx_rd_ptr], size);
+    rx_rd_ptr += size;
+    return 0;
+}
+
+int SMAPGetMACAddress(u8 *buffer)
+{
+    memcpy(buffer, client_mac, 6);
+    return 0;
+}
+
+void smap_set_rx_broadcast(int enable)
+{
+}
+
+// Rx polling as PollRx in smap.c does it: after an interrupt during a read, the SMAP thread polls for more frames,
+// and falls back to interrupts after rx_poll_budget empty polls of about SHIM_POLL_USEC each
+#define SHIM_POLL_USEC 1
+
+static unsigned int rx_poll_budget = 500;
+static int rx_poll_requested = 0;
+static int rx_polling = 0;
+static uint64_t rx_last_frame = 0;
+
+void smap_set_rx_poll(int enable)
+{
+    rx_poll_requested = enable;
+    if (!enable)
+        rx_polling = 0;
+}
+
+void smap_set_rx_poll_budget(unsigned int budget)
+{
+    rx_poll_budget = budget;
+}
+
+u32 smap_get_time_usec(void)
+{
+    return (u32)shim_time_usec();
+}
+
+// Only UDP over IPv4 goes out, the ARP replies have nowhere to go
+static int shim_transmit(void *header, uint16_t headersize, const void *data, uint16_t datasize)
+{
+    const uint8_t *frame = header;
+    uint8_t buf[2048];
+    unsigned int size;
+
+    if (headersize < 42 || frame[12] != 0x08 || frame[13] != 0x00 || frame[23] != 17)
+        return 0;
+
+    size = headersize - 42;
+    memcpy(buf, &frame[42], size);
+    memcpy(&buf[size], data, datasize);
+    size += datasize;
+
+    smap_tx_stats.frames++;
+    smap_tx_stats.bytes += headersize + datasize;
+    if (sendto(sock, buf, size, 0, (struct sockaddr *)&server_addr, sizeof(server_addr)) < 0)
+        return -1;
+
+    return 0;
+}
+
+int smap_transmit(void *header, uint16_t headersize, const void *data, uint16_t datasize)
+{
+    return shim_transmit(header, headersize, data, datasize);
+}
+
+int smap_transmit_nb(void *header, uint16_t headersize, const void *data, uint16_t datasize)
+{
+    return shim_transmit(header, headersize, data, datasize);
+}
+
+// Receives datagrams from the server and feeds them to the stack as ethernet frames
+static void *rx_thread(void *arg)
+{
+    uint8_t buf[2048];
+
+    while (1) {
+        struct sockaddr_in from;
+        socklen_t fromlen = sizeof(from);
+        uint16_t port_dst = UDPBD_CLIENT_PORT; // Stored in the byte order udp_bind() uses
+        uint32_t ip_dst;
+        ssize_t size;
+        uint8_t *f = rx_fifo;
+
+        size = recvfrom(sock, buf, sizeof(buf), 0, (struct sockaddr *)&from, &fromlen);
+        if (size < 0 || (42 + size) > SHIM_FIFO_SIZE)
+            continue;
+
+        shim_lock();
+
+        ip_dst = ms_ip_get_ip();
+        memcpy(&f[0], client_mac, 6);
+        memcpy(&f[6], server_mac, 6);
+        f[12] = 0x08; // IPv4
+        f[13] = 0x00;
+        f[14] = 0x45;
+        f[15] = 0;
+        f[16] = (20 + 8 + size) >> 8;
+        f[17] = (20 + 8 + size) & 0xff;
+        memset(&f[18], 0, 4);
+        f[22] = 64;
+        f[23] = 17; // UDP
+        f[24] = 0;
+        f[25] = 0;
+        memcpy(&f[26], &from.sin_addr.s_addr, 4);
+        f[30] = ip_dst >> 24;
+        f[31] = ip_dst >> 16;
+        f[32] = ip_dst >> 8;
+        f[33] = ip_dst;
+        memcpy(&f[34], &from.sin_port, 2);
+        memcpy(&f[36], &port_dst, 2);
+        f[38] = (8 + size) >> 8;
+        f[39] = (8 + size) & 0xff;
+        f[40] = 0;
+        f[41] = 0;
+        memcpy(&f[42], buf, size);
+
+        smap_rx_stats.frames++;
+        if (rx_polling && (shim_time_usec() - rx_last_frame) <= (uint64_t)rx_poll_budget * SHIM_POLL_USEC) {
+            smap_rx_stats.polled++;
+        } else {
+            smap_rx_stats.interrupts++;
+            rx_polling = rx_poll_requested && rx_poll_budget > 0;
+        }
+        rx_last_frame = shim_time_usec();
+        handle_rx_eth(0);
+
+        shim_unlock();
+    }
+
+    return NULL;
+}
+
+// The part of the SMAP thread the client relies on
+static void *smap_thread(void *arg)
+{
+    u32 bits;
+
+    shim_lock();
+    while (1) {
+        WaitEventFlag(SmapDriverData.Dev9IntrEventFlag, SMAP_EVENT_DISCOVER, WEF_OR | WEF_CLEAR, &bits);
+        udpbd_discover();
+    }
+
+    return NULL;
+}
+
+int shim_start(const char *server, int port, unsigned int rev)
+{
+    struct sockaddr_in local;
+    iop_event_t event;
+    pthread_t thread;
+    int broadcast = 1;
+
+    memset(&server_addr, 0, sizeof(server_addr));
+    server_addr.sin_family = AF_INET;
+    server_addr.sin_port   = htons(port);
+    if (inet_pton(AF_INET, server, &server_addr.sin_addr) != 1) {
+        fprintf(stderr, "invalid server address %s\n", server);
+        return -1;
+    }
+
+    if ((sock = socket(AF_INET, SOCK_DGRAM, 0)) < 0) {
+        perror("socket");
+        return -1;
+    }
+    setsockopt(sock, SOL_SOCKET, SO_BROADCAST, &broadcast, sizeof(broadcast));
+
+    memset(&local, 0, sizeof(local));
+    local.sin_family      = AF_INET;
+    local.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (bind(sock, (struct sockaddr *)&local, sizeof(local)) < 0) {
+        perror("bind");
+        return -1;
+    }
+
+    spd_rev = rev;
+    shim_cond_init(&alarm_cond);
+    shim_cond_init(&connect_cond);
+
+    shim_lock();
+
+    event.attr   = 0;
+    event.option = 0;
+    event.bits   = 0;
+    SmapDriverData.Dev9IntrEventFlag = CreateEventFlag(&event);
+    SmapDriverData.SmapIsInitialized = 1;
+    SmapDriverData.LinkStatus        = 1;
+
+    pthread_create(&thread, NULL, alarm_thread, NULL);
+    pthread_create(&thread, NULL, rx_thread, NULL);
+    pthread_create(&thread, NULL, smap_thread, NULL);
+
+    udpbd_init();
+
+    shim_unlock();
+
+    return 0;
+}
@@ -0,0 +1,41 @@
+#ifndef SHIM_H
+#define SHIM_H
+
+
+#include "ps2shim.h"
+
+
+/**
+ * Start the emulated IOP: Rx, alarm and SMAP threads, then udpbd_init()
+ * @param server   UDPBD server address, where all frames are sent to
+ * @param port     UDPBD server port
+ * @param spd_rev  SPEED revision reported to the client (<= 0x12 limits DMA blocks to 128 bytes)
+ * @return 0 on success, -1 on error
+ */
+int shim_start(const char *server, int port, unsigned int spd_rev);
+
+/**
+ * Wait for the client to find the server
+ * @param timeout_ms Maximum time to wait
+ * @return block device, or NULL on timeout
+ */
+struct block_device *shim_wait_connect(unsigned int timeout_ms);
+
+/**
+ * Take and release the big IOP lock, all calls into the client must hold it
+ */
+void shim_lock(void);
+void shim_unlock(void);
+
+/**
+ * Call the devctl handler of the "udpbd" statistics device
+ */
+int shim_devctl(int cmd, void *buf, unsigned int buflen);
+
+/**
+ * Microseconds since an arbitrary point in time
+ */
+uint64_t shim_time_usec(void);
+
+
+#endif
@@ -0,0 +1,87 @@
+#ifndef SMAP_UDPBD_H
+#define SMAP_UDPBD_H
+
+
+#include <stdint.h>
+
+
+// Device registered by the module, use with fileXioDevctl("udpbd:", ...)
+#define UDPBD_DEVNAME  "udpbd"
+
+// Default sector cache size in KiB, override with the cache=<KiB> module argument (0 disables the cache)
+#define UDPBD_CACHE_DEFAULT_SIZE  64
+
+#define UDPBD_DEVCTL_GET_CACHE_STATS  0x5501 // Returns struct udpbd_cache_stats
+#define UDPBD_DEVCTL_RESET_STATS      0x5502
+#define UDPBD_DEVCTL_GET_RX_STATS     0x5503 // Returns struct smap_rx_stats
+#define UDPBD_DEVCTL_GET_LINK_STATS   0x5504 // Returns struct smap_link_stats
+#define UDPBD_DEVCTL_GET_TX_STATS     0x5505 // Returns struct smap_tx_stats
+#define UDPBD_DEVCTL_GET_IO_STATS     0x5506 // Returns struct udpbd_io_stats
+
+// Latency histogram buckets: bucket n counts commands that took [2^n, 2^(n+1)) microseconds,
+// the last bucket also counts anything slower
+#define UDPBD_HIST_BUCKETS  24
+
+
+struct udpbd_cache_stats {
+    uint32_t hits;       // Sectors served from the cache
+    uint32_t misses;     // Sectors that had to be requested from the server
+    uint32_t prefetched; // Sectors read ahead of a sequential stream
+    uint32_t evictions;  // Valid lines that were replaced
+    uint32_t lines;      // Number of cache lines, 0 if the cache is disabled
+    uint32_t line_size;  // Cache line size in bytes
+};
+
+// Frames that passed the EMAC3 address filter, and why the stack dropped them
+struct smap_rx_stats {
+    uint32_t frames;     // Frames received
+    uint32_t drop_error; // Receive errors (FCS, length, overrun, ...)
+    uint32_t drop_type;  // Neither IPv4 nor ARP
+    uint32_t drop_arp;   // ARP not addressed to us
+    uint32_t drop_proto; // IPv4 but not UDP
+    uint32_t drop_port;  // UDP to a port nobody listens on
+    uint32_t interrupts; // SMAP interrupts handled
+    uint32_t polled;     // Frames picked up by polling instead of an interrupt
+};
+
+struct smap_tx_stats {
+    uint32_t frames;      // Frames queued for transmission
+    uint32_t bytes;       // Bytes queued, without FCS
+    uint32_t ring_full;   // Times a sender had to wait for room in the Tx ring
+    uint32_t drop_busy;   // Frames dropped because the Tx ring was busy (SMAP thread and non-blocking sockets only)
+    uint32_t tty_dropped; // UDPTTY output bytes dropped
+    uint32_t drop_full;     // Frames the SMAP thread dropped because the Tx ring did not drain
+    uint32_t wait_timeouts; // Waits for room in the Tx ring that ended without TXEND
+};
+
+struct udpbd_io_stats {
+    uint32_t reads;         // READ commands sent, including retries
+    uint32_t writes;        // WRITE commands sent
+    uint32_t bytes_read;    // Bytes received by completed READ commands
+    uint32_t bytes_written; // Bytes sent by completed WRITE commands
+    uint32_t retries;       // READ commands repeated after an error
+    uint32_t timeouts;      // Commands without a complete reply in time
+    uint32_t bad_cmdpkt;    // RDMA packets received out of order
+    uint32_t bad_size;      // RDMA packets with an invalid size
+    uint32_t write_errors;  // WRITE commands failed by the server
+    uint32_t stale;         // Packets for an earlier command (wrong cmdid)
+    uint32_t disconnects;   // Times the server was dropped after too many errors
+    uint32_t dma_errors;    // RDMA packets that could not be transferred to memory
+    uint32_t read_hist[UDPBD_HIST_BUCKETS];  // READ command latency, successful commands only
+    uint32_t write_hist[UDPBD_HIST_BUCKETS]; // WRITE command latency, successful commands only
+    uint32_t duplicates;    // RDMA packets received twice, ignored
+    uint32_t geometry_resends; // RDMA geometry set again because packets did not match it
+};
+
+struct smap_link_stats {
+    uint32_t link_up_time; // Microseconds from the start of PHY initialization to link up
+    uint32_t link_mode;    // 1 = 10M HDX, 2 = 10M FDX, 4 = 100M HDX, 8 = 100M FDX, | 0x40 with flow control
+    uint32_t fast_link;    // 1 if an already established link was reused
+    uint32_t discovery_time;  // Microseconds from the first INFO request to the server reply, 0 while not found
+    uint32_t discovery_tries; // INFO requests sent
+    uint32_t rdma_block_size; // Read RDMA block size chosen by calibration, 0 if the server chooses
+    uint32_t calibration_time; // Microseconds spent finding the best RDMA geometry
+};
+
+
+#endif
@@ -7,10 +7,11 @@
 #include <bdm.h>
 #include <dev9.h>
 #include <intrman.h>
-#include <ioman.h>
+#include <iomanX.h>
 #include <loadcore.h>
 #include <stdio.h>
 #include <sysclib.h>
+#include <sysmem.h>
 #include <thbase.h>
 #include <thevent.h>
 #include <thsemap.h>
@@ -4,6 +4,7 @@
 
 #include <thbase.h>
 #include "mprintf.h"
+#include "smap_udpbd.h"
 
 #define MODNAME "SMAP_driver"
 
@@ -32,10 +33,20 @@ struct SmapDriverData
 #define SMAP_EVENT_START      0x01
 #define SMAP_EVENT_INTR       0x04
 #define SMAP_EVENT_LINK_CHECK 0x10
+#define SMAP_EVENT_DISCOVER   0x20
+#define SMAP_EVENT_TTY_FLUSH  0x40
+
+extern struct SmapDriverData SmapDriverData;
+extern struct smap_link_stats smap_link_stats;
 
 /* Function prototypes */
 int smap_init(int argc, char *argv[]);
 int SMAPGetMACAddress(u8 *buffer);
+void smap_set_rx_broadcast(int enable);
+void smap_set_rx_multicast(int enable);
+void smap_set_rx_poll(int enable);
+void smap_set_rx_poll_budget(unsigned int budget);
+u32 smap_get_time_usec(void);
 
 
 #endif
@@ -4,6 +4,11 @@
 
 #include <stdint.h>
 #include "main.h"
+#include "smap_udpbd.h"
+
+
+extern struct smap_rx_stats smap_rx_stats;
+extern struct smap_tx_stats smap_tx_stats;
 
 
 /**
@@ -14,8 +19,15 @@
  */
 int smap_transmit(void *header, uint16_t headersize, const void *data, uint16_t datasize);
 
+/**
+ * Send data over the network, without waiting for room in the Tx ring
+ * @return 0 on succes, -1 when the frame was dropped
+ */
+int smap_transmit_nb(void *header, uint16_t headersize, const void *data, uint16_t datasize);
+
 void xfer_init(void);
 int HandleRxIntr(struct SmapDriverData *SmapDrivPrivData);
+void HandleTxIntr(struct SmapDriverData *SmapDrivPrivData);
 
 
 #endif
@@ -8,6 +8,10 @@
 #include "main.h"
 #include "xfer.h"
 #include "ministack.h"
+#include "udptty.h"
+#ifndef NO_BDM
+#include "udpbd.h"
+#endif
 
 // Last SDK 3.1.0 has INET family version "2.26.0"
 // SMAP module is the same as "2.25.0"
@@ -52,6 +56,24 @@ int _start(int argc, char *argv[])
         return MODULE_NO_RESIDENT_END;
     }
 
+    // Settings must be in place before smap_init() starts the SMAP thread,
+    // which allocates the UDPBD cache and starts discovery as soon as the link is up
+    for (i=1; i<argc; i++) {
+        M_DEBUG("argv[%d] = %s\n", i, argv[i]);
+        if (!strncmp(argv[i], "rxpoll=", 7))
+            smap_set_rx_poll_budget(strtol(&argv[i][7], NULL, 10));
+        else if (!strncmp(argv[i], "mcast=", 6))
+            smap_set_rx_multicast(strtol(&argv[i][6], NULL, 10));
+        else if (!strncmp(argv[i], "ttynb=", 6))
+            udptty_set_nonblocking(strtol(&argv[i][6], NULL, 10));
+#ifndef NO_BDM
+        else if (!strncmp(argv[i], "cache=", 6))
+            udpbd_set_cache_size(strtol(&argv[i][6], NULL, 10));
+        else if (!strncmp(argv[i], "discover=", 9))
+            udpbd_set_discover_timeout(strtol(&argv[i][9], NULL, 10));
+#endif
+    }
+
     if ((result = smap_init(argc, argv)) < 0) {
         M_DEBUG("smap: smap_init -> %d\n", result);
         ReleaseLibraryEntries(&_exp_smap);
@@ -59,7 +81,6 @@ int _start(int argc, char *argv[])
     }
 
     for (i=1; i<argc; i++) {
-        M_DEBUG("argv[%d] = %s\n", i, argv[i]);
         if (!strncmp(argv[i], "ip=", 3)) {
             uint32_t ip = parse_ip(&argv[i][3]);
             if (ip != 0)
@@ -31,7 +31,10 @@ void ip_packet_init(ip_packet_t *pkt, uint32_t ip_dest)
 {
     eth_packet_init((eth_packet_t *)pkt, ETH_TYPE_IPV4);
 
-    // IP, broadcast
+    // Unicast if the destination is known, broadcast otherwise
+    arp_get_entry(ip_dest, pkt->eth.addr_dst);
+
+    // IP
     pkt->ip.hlen             = 0x45;
     pkt->ip.tos              = 0;
     //pkt->ip_len              = ;
@@ -80,11 +83,16 @@ int eth_packet_send_ll(eth_packet_t *pkt, uint16_t pktdatasize, const void *data
     return smap_transmit(pkt, sizeof(eth_header_t) + pktdatasize, data, datasize);
 }
 
-int ip_packet_send_ll(ip_packet_t *pkt, uint16_t pktdatasize, const void *data, uint16_t datasize)
+static inline void ip_packet_prepare(ip_packet_t *pkt, uint16_t size)
 {
-    pkt->ip.len  = htons(sizeof(ip_header_t) + pktdatasize + datasize);
+    pkt->ip.len  = htons(size);
     pkt->ip.csum = 0;
     pkt->ip.csum = ip_checksum(&pkt->ip);
+}
+
+int ip_packet_send_ll(ip_packet_t *pkt, uint16_t pktdatasize, const void *data, uint16_t datasize)
+{
+    ip_packet_prepare(pkt, sizeof(ip_header_t) + pktdatasize + datasize);
 
     return eth_packet_send_ll((eth_packet_t *)pkt, sizeof(ip_header_t) + pktdatasize, data, datasize);
 }
@@ -100,6 +108,7 @@ udp_socket_t *udp_bind(uint16_t port_src, udp_port_handler handler, void *handle
             udp_ports[i].port_src    = port_src;
             udp_ports[i].handler     = handler;
             udp_ports[i].handler_arg = handler_arg;
+            udp_ports[i].flags       = 0;
             return &udp_ports[i];
         }
     }
@@ -113,6 +122,11 @@ int udp_packet_send_ll(udp_socket_t *socket, udp_packet_t *pkt, uint16_t pktdata
     pkt->udp.len  = htons(sizeof(udp_header_t) + pktdatasize + datasize);
     pkt->udp.csum = 0; // not needed
 
+    if (socket->flags & UDP_SOCKET_NONBLOCK) {
+        ip_packet_prepare((ip_packet_t *)pkt, sizeof(ip_header_t) + sizeof(udp_header_t) + pktdatasize + datasize);
+        return smap_transmit_nb(pkt, sizeof(eth_header_t) + sizeof(ip_header_t) + sizeof(udp_header_t) + pktdatasize, data, datasize);
+    }
+
     return ip_packet_send_ll((ip_packet_t *)pkt, sizeof(udp_header_t) + pktdatasize, data, datasize);
 }
 
@@ -135,7 +149,7 @@ int arp_add_entry(uint32_t ip, uint8_t mac[6])
 
     // Add new entry
     for (i=0; i<MS_ARP_ENTRIES; i++) {
-        if (ip == 0) {
+        if (arp_table[i].ip == 0) {
             arp_table[i].ip  = ip;
             arp_table[i].mac[0] = mac[0];
             arp_table[i].mac[1] = mac[1];
@@ -150,30 +164,43 @@ int arp_add_entry(uint32_t ip, uint8_t mac[6])
     return -1;
 }
 
-static inline int handle_rx_arp(uint16_t pointer)
+int arp_get_entry(uint32_t ip, uint8_t mac[6])
+{
+    int i;
+
+    if (ip == 0 || ip == IP_ADDR(255,255,255,255))
+        return -1;
+
+    for (i=0; i<MS_ARP_ENTRIES; i++) {
+        if (ip == arp_table[i].ip) {
+            mac[0] = arp_table[i].mac[0];
+            mac[1] = arp_table[i].mac[1];
+            mac[2] = arp_table[i].mac[2];
+            mac[3] = arp_table[i].mac[3];
+            mac[4] = arp_table[i].mac[4];
+            mac[5] = arp_table[i].mac[5];
+            return 0;
+        }
+    }
+
+    return -1;
+}
+
+static inline int handle_rx_arp(const ms_rx_header_t *hdr)
 {
-    USE_SMAP_REGS;
-    arp_packet_t req;
     static arp_packet_t reply;
-    uint32_t *parp = (uint32_t*)&req;
-
-    SMAP_REG16(SMAP_R_RXFIFO_RD_PTR) = pointer + 12;
-    parp[ 3] = SMAP_REG32(SMAP_R_RXFIFO_DATA); //  2
-    parp[ 4] = SMAP_REG32(SMAP_R_RXFIFO_DATA); //  6
-    parp[ 5] = SMAP_REG32(SMAP_R_RXFIFO_DATA); // 10
-    parp[ 6] = SMAP_REG32(SMAP_R_RXFIFO_DATA); // 14
-    parp[ 7] = SMAP_REG32(SMAP_R_RXFIFO_DATA); // 18
-    parp[ 8] = SMAP_REG32(SMAP_R_RXFIFO_DATA); // 22
-    parp[ 9] = SMAP_REG32(SMAP_R_RXFIFO_DATA); // 26
-    parp[10] = SMAP_REG32(SMAP_R_RXFIFO_DATA); // 30
-
-    if (ntohs(req.arp.oper) == 1 && ntohl(req.arp.target_ip) == ip_addr) {
-        reply.eth.addr_dst[0] = req.arp.sender_mac[0];
-        reply.eth.addr_dst[1] = req.arp.sender_mac[1];
-        reply.eth.addr_dst[2] = req.arp.sender_mac[2];
-        reply.eth.addr_dst[3] = req.arp.sender_mac[3];
-        reply.eth.addr_dst[4] = req.arp.sender_mac[4];
-        reply.eth.addr_dst[5] = req.arp.sender_mac[5];
+    const arp_packet_t *req = &hdr->arp;
+
+    if (ntohs(req->arp.oper) == 1 && ntohl(req->arp.target_ip) == ip_addr) {
+        // Whoever asks for us is about to talk to us, remember them
+        arp_add_entry(ntohl(req->arp.sender_ip), (uint8_t *)req->arp.sender_mac);
+
+        reply.eth.addr_dst[0] = req->arp.sender_mac[0];
+        reply.eth.addr_dst[1] = req->arp.sender_mac[1];
+        reply.eth.addr_dst[2] = req->arp.sender_mac[2];
+        reply.eth.addr_dst[3] = req->arp.sender_mac[3];
+        reply.eth.addr_dst[4] = req->arp.sender_mac[4];
+        reply.eth.addr_dst[5] = req->arp.sender_mac[5];
         SMAPGetMACAddress(reply.eth.addr_src);
         reply.eth.type = htons(ETH_TYPE_ARP);
         reply.arp.htype = htons(1); // ethernet
@@ -182,53 +209,43 @@ static inline int handle_rx_arp(uint16_t pointer)
         reply.arp.plen = 4;
         reply.arp.oper = htons(2); // reply
         SMAPGetMACAddress(reply.arp.sender_mac);
-        reply.arp.sender_ip     = req.arp.target_ip;
-        reply.arp.target_mac[0] = req.arp.sender_mac[0];
-        reply.arp.target_mac[1] = req.arp.sender_mac[1];
-        reply.arp.target_mac[2] = req.arp.sender_mac[2];
-        reply.arp.target_mac[3] = req.arp.sender_mac[3];
-        reply.arp.target_mac[4] = req.arp.sender_mac[4];
-        reply.arp.target_mac[5] = req.arp.sender_mac[5];
-        reply.arp.target_ip     = req.arp.sender_ip;
+        reply.arp.sender_ip     = req->arp.target_ip;
+        reply.arp.target_mac[0] = req->arp.sender_mac[0];
+        reply.arp.target_mac[1] = req->arp.sender_mac[1];
+        reply.arp.target_mac[2] = req->arp.sender_mac[2];
+        reply.arp.target_mac[3] = req->arp.sender_mac[3];
+        reply.arp.target_mac[4] = req->arp.sender_mac[4];
+        reply.arp.target_mac[5] = req->arp.sender_mac[5];
+        reply.arp.target_ip     = req->arp.sender_ip;
         smap_transmit(&reply, 0x2A, NULL, 0);
-    }
+    } else
+        smap_rx_stats.drop_arp++;
 
     return -1;
 }
 
-static inline int handle_rx_udp(uint16_t pointer)
+static inline int handle_rx_udp(const ms_rx_header_t *hdr)
 {
-    USE_SMAP_REGS;
-    uint16_t dport;
     int i;
 
-    // Check port
-    SMAP_REG16(SMAP_R_RXFIFO_RD_PTR) = pointer + 0x24;
-    dport = SMAP_REG16(SMAP_R_RXFIFO_DATA);
-
     for (i=0; i<UDP_MAX_PORTS; i++) {
-        if (dport == udp_ports[i].port_src)
-            return udp_ports[i].handler(&udp_ports[i], pointer, udp_ports[i].handler_arg);
+        if (hdr->udp.port_dst == udp_ports[i].port_src)
+            return udp_ports[i].handler(&udp_ports[i], hdr, udp_ports[i].handler_arg);
     }
 
-    //M_DEBUG("ministack: udp: dport 0x%X\n", dport);
+    //M_DEBUG("ministack: udp: dport 0x%X\n", hdr->udp.port_dst);
+    smap_rx_stats.drop_port++;
     return -1;
 }
 
-static inline int handle_rx_ipv4(uint16_t pointer)
+static inline int handle_rx_ipv4(const ms_rx_header_t *hdr)
 {
-    USE_SMAP_REGS;
-    uint8_t protocol;
-
-    // Check ethernet type
-    SMAP_REG16(SMAP_R_RXFIFO_RD_PTR) = pointer + 0x14;
-    protocol = SMAP_REG32(SMAP_R_RXFIFO_DATA) >> 24;
-
-    switch (protocol) {
+    switch (hdr->ip.proto) {
         case IP_PROTOCOL_UDP:
-            return handle_rx_udp(pointer);
+            return handle_rx_udp(hdr);
         default:
-            //M_DEBUG("ministack: ipv4: protocol 0x%X\n", protocol);
+            //M_DEBUG("ministack: ipv4: protocol 0x%X\n", hdr->ip.proto);
+            smap_rx_stats.drop_proto++;
             return -1;
     }
 }
@@ -236,19 +253,37 @@ static inline int handle_rx_ipv4(uint16_t pointer)
 int handle_rx_eth(uint16_t pointer)
 {
     USE_SMAP_REGS;
-    uint16_t eth_type;
-
-    // Check ethernet type
-    SMAP_REG16(SMAP_R_RXFIFO_RD_PTR) = pointer + 12;
-    eth_type = ntohs(SMAP_REG16(SMAP_R_RXFIFO_DATA));
-
-    switch (eth_type) {
+    ms_rx_header_t hdr;
+
+    // Read all headers in one burst, no more seeking around in the FIFO
+    SMAP_REG16(SMAP_R_RXFIFO_RD_PTR) = pointer;
+    hdr.w[ 0] = SMAP_REG32(SMAP_R_RXFIFO_DATA);
+    hdr.w[ 1] = SMAP_REG32(SMAP_R_RXFIFO_DATA);
+    hdr.w[ 2] = SMAP_REG32(SMAP_R_RXFIFO_DATA);
+    hdr.w[ 3] = SMAP_REG32(SMAP_R_RXFIFO_DATA);
+    hdr.w[ 4] = SMAP_REG32(SMAP_R_RXFIFO_DATA);
+    hdr.w[ 5] = SMAP_REG32(SMAP_R_RXFIFO_DATA);
+    hdr.w[ 6] = SMAP_REG32(SMAP_R_RXFIFO_DATA);
+    hdr.w[ 7] = SMAP_REG32(SMAP_R_RXFIFO_DATA);
+    hdr.w[ 8] = SMAP_REG32(SMAP_R_RXFIFO_DATA);
+    hdr.w[ 9] = SMAP_REG32(SMAP_R_RXFIFO_DATA);
+    hdr.w[10] = SMAP_REG32(SMAP_R_RXFIFO_DATA);
+
+    // Fast path: IPv4 + UDP to the first bound socket (UDPBD)
+    // - w[3] bits  0..15: ethernet type
+    // - w[5] bits 24..31: IP protocol
+    // - w[9] bits  0..15: UDP destination port
+    if ((hdr.w[3] & 0xffff) == htons(ETH_TYPE_IPV4) && (hdr.w[5] >> 24) == IP_PROTOCOL_UDP && (hdr.w[9] & 0xffff) == udp_ports[0].port_src && udp_ports[0].handler != NULL)
+        return udp_ports[0].handler(&udp_ports[0], &hdr, udp_ports[0].handler_arg);
+
+    switch (ntohs(hdr.eth.type)) {
         case ETH_TYPE_ARP:
-            return handle_rx_arp(pointer);
+            return handle_rx_arp(&hdr);
         case ETH_TYPE_IPV4:
-            return handle_rx_ipv4(pointer);
+            return handle_rx_ipv4(&hdr);
         default:
-            //M_DEBUG("ministack: eth: type 0x%X\n", eth_type);
+            //M_DEBUG("ministack: eth: type 0x%X\n", ntohs(hdr.eth.type));
+            smap_rx_stats.drop_type++;
             return -1;
     }
 }
@@ -108,6 +108,20 @@ typedef struct
     //char payload[UDP_MAX_PAYLOAD];
 } __attribute__((packed, aligned(4))) udp_packet_t;
 
+/* Headers of a received frame, read from the Rx FIFO in one burst (44 bytes) */
+typedef union
+{
+    uint32_t w[11];
+    struct
+    {
+        eth_header_t eth; // 14 bytes, offset + 0
+        ip_header_t ip;   // 20 bytes, offset +14 (0x0E)
+        udp_header_t udp; //  8 bytes, offset +34 (0x22)
+        uint16_t payload; //  2 bytes, offset +42 (0x2A) - first 2 bytes of the UDP payload
+    } __attribute__((packed, aligned(4)));
+    arp_packet_t arp;
+} ms_rx_header_t;
+
 #define ETH_TYPE_IPV4 0x0800
 #define ETH_TYPE_ARP  0x0806
 
@@ -170,16 +184,26 @@ static inline int ip_packet_send(ip_packet_t *header, uint16_t size)
 }
 
 struct udp_socket;
-typedef int (*udp_port_handler)(struct udp_socket *socket, uint16_t pointer, void *arg);
+/**
+ * UDP port handler, called from the SMAP interrupt thread
+ * @param socket UDP socket
+ * @param hdr Headers of the received frame
+ * @param arg Handler argument
+ * The Rx FIFO read pointer is at the UDP payload + 2 (offset 0x2C)
+ */
+typedef int (*udp_port_handler)(struct udp_socket *socket, const ms_rx_header_t *hdr, void *arg);
 typedef struct udp_socket
 {
     uint16_t port_src;
     udp_port_handler handler;
     void *handler_arg;
+    uint32_t flags;
 } udp_socket_t;
+#define UDP_SOCKET_NONBLOCK (1 << 0) // Drop the packet instead of waiting for room in the Tx ring
 
 /**
  * Bind to UDP port, and start receiving UDP messages
+ * The first socket bound gets a fast path in the receive handler.
  * @param port_src    UDP port to listen to
  * @param handler     UDP port handler
  * @param handler_arg UDP port handler argument
@@ -202,7 +226,7 @@ void udp_packet_init(udp_packet_t *pkt, uint32_t ip_dst, uint16_t port_dst);
  * @param pktdatasize Size of the payload in bytes
  * @param data Separate payload
  * @param datasize Size separate payload in bytes
- * @return 0 on succes, -1 on failure
+ * @return 0 on succes, -1 on failure (or when the Tx ring is full on a UDP_SOCKET_NONBLOCK socket)
  */
 int udp_packet_send_ll(udp_socket_t *socket, udp_packet_t *pkt, uint16_t pktdatasize, const void *data, uint16_t datasize);
 
@@ -233,7 +257,21 @@ uint32_t ms_ip_get_ip();
 
 
 
+/**
+ * Add or update an entry in the ARP table
+ * @param ip IP address
+ * @param mac MAC address
+ * @return 0 on succes, -1 if the table is full
+ */
 int arp_add_entry(uint32_t ip, uint8_t mac[6]);
+
+/**
+ * Look up the MAC address of an IP address
+ * @param ip IP address
+ * @param mac Receives the MAC address, untouched if not found
+ * @return 0 on succes, -1 if not found
+ */
+int arp_get_entry(uint32_t ip, uint8_t mac[6]);
 int handle_rx_eth(uint16_t pointer);
 
 
@@ -62,6 +62,26 @@ static unsigned int EnableVerboseOutput = 0;
 static unsigned int EnableAutoNegotiation = 1;
 static unsigned int EnablePinStrapConfig = 0;
 static unsigned int SmapConfiguration = 0x5E0;
+static unsigned int EnableRxBroadcast = 1;
+static unsigned int EnableRxMulticast = 0;
+static unsigned int RxPollBudget = 500;            // Empty polls before falling back to interrupts, 0 disables polling
+static volatile unsigned int RxPollRequested = 0;  // Set while a bulk transfer is expected
+struct smap_link_stats smap_link_stats;
+
+#define PHY_POLL_INTERVAL   20000   // Auto negotiation status is polled every 20ms
+#define PHY_ANEG_TIMEOUT    3000000 // Restart auto negotiation if it does not complete in 3s
+#define PHY_LINK_TIMEOUT    4000000 // Restart auto negotiation if the link does not come up 4s after it completed
+
+u32 smap_get_time_usec(void)
+{
+    iop_sys_clock_t clock;
+    u32 sec, usec;
+
+    GetSystemTime(&clock);
+    SysClock2USec(&clock, &sec, &usec);
+
+    return sec * 1000000 + usec;
+}
 
 static void _smap_write_phy(volatile u8 *emac3_regbase, unsigned int address, u16 value)
 {
@@ -126,12 +146,29 @@ static inline void RestartAutoNegotiation(volatile u8 *emac3_regbase, u16 bmsr)
 static int InitPHY(struct SmapDriverData *SmapDrivPrivData)
 {
     int i, result;
-    unsigned int LinkSpeed100M, LinkFDX, FlowControlEnabled, AutoNegoRetries;
-    u32 emac3_value;
+    unsigned int LinkSpeed100M, LinkFDX, FlowControlEnabled, AutoNegoRetries, FastLink;
+    u32 emac3_value, StartTime;
     u16 RegDump[6], value, value2;
     volatile u8 *emac3_regbase;
 
     LinkSpeed100M = 0;
+    FastLink = 0;
+    StartTime = smap_get_time_usec();
+
+    /*  Non-Sony: if auto negotiation already completed and the link is up (after an IOP reboot for example),
+        keep it. Resetting the PHY would cost several seconds of negotiating the same result again.
+        The link status bit latches low, so the first read only clears a stale link down. */
+    if (EnableAutoNegotiation && !EnablePinStrapConfig && (_smap_read_phy(SmapDrivPrivData->emac3_regbase, SMAP_DsPHYTER_BMCR) & SMAP_PHY_BMCR_ANEN)) {
+        _smap_read_phy(SmapDrivPrivData->emac3_regbase, SMAP_DsPHYTER_BMSR);
+        value = _smap_read_phy(SmapDrivPrivData->emac3_regbase, SMAP_DsPHYTER_BMSR);
+        if ((value & (SMAP_PHY_BMSR_LINK | SMAP_PHY_BMSR_ANCP | 0x10)) == (SMAP_PHY_BMSR_LINK | SMAP_PHY_BMSR_ANCP)) {
+            M_DEBUG("smap: link already up (BMSR=0x%x)\n", value);
+            SmapDrivPrivData->LinkStatus = 1;
+            FastLink = 1;
+            goto LinkUp;
+        }
+    }
+
     if (EnableVerboseOutput != 0)
         M_DEBUG("smap: Resetting PHY\n");
 
@@ -203,24 +240,27 @@ static int InitPHY(struct SmapDriverData *SmapDrivPrivData)
 
     RepeatAutoNegoProcess:
         for (AutoNegoRetries = 0; AutoNegoRetries < 3; AutoNegoRetries++) {
-            for (i = 0; i < 15; i++) {
-                DelayThread(200000);
+            /*  Non-Sony: poll for completion instead of always waiting the full 3 seconds. */
+            for (i = 0; i < PHY_ANEG_TIMEOUT / PHY_POLL_INTERVAL; i++) {
+                DelayThread(PHY_POLL_INTERVAL);
                 if (SmapDrivPrivData->NetDevStopFlag)
                     return 0;
+                if (_smap_read_phy(SmapDrivPrivData->emac3_regbase, SMAP_DsPHYTER_BMSR) & SMAP_PHY_BMSR_ANCP)
+                    break;
             }
 
             value = _smap_read_phy(SmapDrivPrivData->emac3_regbase, SMAP_DsPHYTER_BMSR);
             if ((value & (SMAP_PHY_BMSR_ANCP | 0x10)) == SMAP_PHY_BMSR_ANCP) { /* 0x30: SMAP_PHY_BMSR_ANCP and Remote fault. */
                 /* This seems to be checking for the link-up status. */
                 for (i = 0; !(_smap_read_phy(SmapDrivPrivData->emac3_regbase, SMAP_DsPHYTER_BMSR) & SMAP_PHY_BMSR_LINK); i++) {
-                    DelayThread(200000);
+                    DelayThread(PHY_POLL_INTERVAL);
                     if (SmapDrivPrivData->NetDevStopFlag)
                         return 0;
-                    if (i >= 20)
+                    if (i >= PHY_LINK_TIMEOUT / PHY_POLL_INTERVAL)
                         break;
                 }
 
-                if (i < 20) {
+                if (i < PHY_LINK_TIMEOUT / PHY_POLL_INTERVAL) {
                     /* Auto negotiaton completed successfully. */
                     SmapDrivPrivData->LinkStatus = 1;
                     break;
@@ -278,6 +318,11 @@ static int InitPHY(struct SmapDriverData *SmapDrivPrivData)
         }
     }
 
+LinkUp:
+    smap_link_stats.link_up_time = smap_get_time_usec() - StartTime;
+    smap_link_stats.fast_link    = FastLink;
+    M_DEBUG("smap: link up after %dms\n", smap_link_stats.link_up_time / 1000);
+
     for (i = 0; i < 6; i++)
         RegDump[i] = _smap_read_phy(SmapDrivPrivData->emac3_regbase, i);
 
@@ -286,7 +331,8 @@ static int InitPHY(struct SmapDriverData *SmapDrivPrivData)
 
     /* Special initialization for the National Semiconductor DP83846A PHY. */
     if (RegDump[SMAP_DsPHYTER_PHYIDR1] == SMAP_PHY_IDR1_VAL && (RegDump[SMAP_DsPHYTER_PHYIDR2] & SMAP_PHY_IDR2_MSK) == SMAP_PHY_IDR2_VAL) {
-        if (EnableAutoNegotiation) {
+        /* The receive error check costs 500ms, a reused link has already proven itself. */
+        if (EnableAutoNegotiation && !FastLink) {
             _smap_read_phy(SmapDrivPrivData->emac3_regbase, SMAP_DsPHYTER_FCSCR);
             _smap_read_phy(SmapDrivPrivData->emac3_regbase, SMAP_DsPHYTER_RECR);
             DelayThread(500000);
@@ -343,6 +389,7 @@ static int InitPHY(struct SmapDriverData *SmapDrivPrivData)
     SmapDrivPrivData->LinkMode = result;
     if (FlowControlEnabled)
         SmapDrivPrivData->LinkMode |= 0x40;
+    smap_link_stats.link_mode = SmapDrivPrivData->LinkMode;
 
     M_DEBUG("smap: %s %s Duplex Mode %s Flow Control\n", LinkSpeed100M ? "100BaseTX" : "10BaseT", LinkFDX ? "Full" : "Half", FlowControlEnabled ? "with" : "without");
 
@@ -357,6 +404,76 @@ static int InitPHY(struct SmapDriverData *SmapDrivPrivData)
     return 0;
 }
 
+// Programs the EMAC3 address filter. Frames that don't pass it never reach the Rx FIFO or raise an interrupt.
+static void SetRxMode(volatile u8 *emac3_regbase)
+{
+    u32 mode = SMAP_E3_RX_STRIP_PAD | SMAP_E3_RX_STRIP_FCS | SMAP_E3_RX_INDIVID_ADDR;
+
+    if (EnableRxBroadcast)
+        mode |= SMAP_E3_RX_BCAST;
+    if (EnableRxMulticast)
+        mode |= SMAP_E3_RX_PROMISC_MCAST;
+
+    SMAP_EMAC3_SET32(SMAP_R_EMAC3_RxMODE, mode);
+}
+
+void smap_set_rx_broadcast(int enable)
+{
+    if (EnableRxBroadcast != (enable != 0)) {
+        EnableRxBroadcast = (enable != 0);
+        // smap_init() applies the mode if the driver isn't initialized yet
+        if (SmapDriverData.emac3_regbase != NULL)
+            SetRxMode(SmapDriverData.emac3_regbase);
+    }
+}
+
+void smap_set_rx_multicast(int enable)
+{
+    if (EnableRxMulticast != (enable != 0)) {
+        EnableRxMulticast = (enable != 0);
+        // smap_init() applies the mode if the driver isn't initialized yet
+        if (SmapDriverData.emac3_regbase != NULL)
+            SetRxMode(SmapDriverData.emac3_regbase);
+    }
+}
+
+void smap_set_rx_poll(int enable)
+{
+    RxPollRequested = enable;
+}
+
+void smap_set_rx_poll_budget(unsigned int budget)
+{
+    RxPollBudget = budget;
+}
+
+// Keeps receiving frames without interrupts while a bulk transfer is in progress.
+// Stops once the transfer is done, or when no frame arrived for RxPollBudget polls.
+static int PollRx(struct SmapDriverData *SmapDrivPrivData)
+{
+    volatile u8 *smap_regbase;
+    unsigned int idle;
+    int result, received;
+
+    smap_regbase = SmapDrivPrivData->smap_regbase;
+    received = 0;
+    idle = 0;
+    while (RxPollRequested && idle < RxPollBudget) {
+        if ((result = HandleRxIntr(SmapDrivPrivData)) > 0) {
+            smap_rx_stats.polled += result;
+            received += result;
+            idle = 0;
+        } else
+            idle++;
+    }
+
+    // Frames received while polling have latched RXEND, pick up any that are still waiting
+    SMAP_REG16(SMAP_R_INTR_CLR) = SMAP_INTR_RXEND;
+    received += HandleRxIntr(SmapDrivPrivData);
+
+    return received;
+}
+
 // This timer callback starts the Ethernet link check event.
 static unsigned int LinkCheckTimerCB(struct SmapDriverData *SmapDrivPrivData)
 {
@@ -371,6 +488,10 @@ static void CheckLinkStatus(struct SmapDriverData *SmapDrivPrivData)
         // Link lost
         SmapDrivPrivData->LinkStatus = 0;
         InitPHY(SmapDrivPrivData);
+#ifndef NO_BDM
+        if (SmapDrivPrivData->LinkStatus)
+            udpbd_link_up();
+#endif
     }
 }
 
@@ -386,7 +507,7 @@ static void IntrHandlerThread(struct SmapDriverData *SmapDrivPrivData)
     emac3_regbase = SmapDrivPrivData->emac3_regbase;
     smap_regbase = SmapDrivPrivData->smap_regbase;
     while (1) {
-        if ((result = WaitEventFlag(SmapDrivPrivData->Dev9IntrEventFlag, SMAP_EVENT_START | SMAP_EVENT_INTR | SMAP_EVENT_LINK_CHECK, WEF_OR | WEF_CLEAR, &EFBits)) != 0) {
+        if ((result = WaitEventFlag(SmapDrivPrivData->Dev9IntrEventFlag, SMAP_EVENT_START | SMAP_EVENT_INTR | SMAP_EVENT_LINK_CHECK | SMAP_EVENT_DISCOVER | SMAP_EVENT_TTY_FLUSH, WEF_OR | WEF_CLEAR, &EFBits)) != 0) {
             M_DEBUG("smap: WaitEventFlag -> %d\n", result);
             break;
         }
@@ -422,7 +543,9 @@ static void IntrHandlerThread(struct SmapDriverData *SmapDrivPrivData)
         if (SmapDrivPrivData->SmapIsInitialized) {
             ResetCounterFlag = 0;
             if (EFBits & SMAP_EVENT_INTR) {
-                if ((IntrReg = SPD_REG16(SPD_R_INTR_STAT) & DEV9_SMAP_INTR_MASK) != 0) {
+                smap_rx_stats.interrupts++;
+                // TXEND is not in DEV9_SMAP_INTR_MASK, but a sender waiting for the Tx ring may have enabled it
+                if ((IntrReg = SPD_REG16(SPD_R_INTR_STAT) & (DEV9_SMAP_INTR_MASK | SMAP_INTR_TXEND)) != 0) {
                     /*    Original order/priority:
                             1. EMAC3
                             2. RXEND
@@ -435,16 +558,32 @@ static void IntrHandlerThread(struct SmapDriverData *SmapDrivPrivData)
                     if (IntrReg & SMAP_INTR_RXEND) {
                         SMAP_REG16(SMAP_R_INTR_CLR) = SMAP_INTR_RXEND;
                         ResetCounterFlag = HandleRxIntr(SmapDrivPrivData);
+                        // Interrupts stay masked while polling
+                        if (RxPollRequested && RxPollBudget > 0)
+                            ResetCounterFlag += PollRx(SmapDrivPrivData);
                     }
                     if (IntrReg & SMAP_INTR_RXDNV) {
                         SMAP_REG16(SMAP_R_INTR_CLR) = SMAP_INTR_RXDNV;
                     }
+                    if (IntrReg & SMAP_INTR_TXEND) {
+                        // Only enabled by a sender waiting for room in the Tx ring, stays disabled after this.
+                        // The status latches for every frame sent, HandleTxIntr ignores it if nobody waits.
+                        SMAP_REG16(SMAP_R_INTR_CLR) = SMAP_INTR_TXEND;
+                        HandleTxIntr(SmapDrivPrivData);
+                    }
                 }
             }
 
-            // TXDNV is not enabled here, but only when frames are transmitted.
+            // TXEND is not enabled here, but only when a sender waits for the Tx ring.
             dev9IntrEnable(DEV9_SMAP_INTR_MASK2);
 
+#ifndef NO_BDM
+            if (EFBits & SMAP_EVENT_DISCOVER)
+                udpbd_discover();
+#endif
+            if (EFBits & SMAP_EVENT_TTY_FLUSH)
+                udptty_flush();
+
             // Do the link check, only if there has not been any incoming traffic in a while.
             if (ResetCounterFlag) {
                 counter = 3;
@@ -584,7 +723,7 @@ int smap_init(int argc, char *argv[])
     SMAP_EMAC3_SET32(SMAP_R_EMAC3_MODE1, SMAP_E3_FDX_ENABLE | SMAP_E3_IGNORE_SQE | SMAP_E3_MEDIA_100M | SMAP_E3_RXFIFO_2K | SMAP_E3_TXFIFO_1K | SMAP_E3_TXREQ0_MULTI | SMAP_E3_TXREQ1_SINGLE);
     // Tx FIFO request priority. Low: 7*8=56, urgent: 15*8=120.
     SMAP_EMAC3_SET32(SMAP_R_EMAC3_TxMODE1, (7 & SMAP_E3_TX_LOW_REQ_MSK) << SMAP_E3_TX_LOW_REQ_BITSFT | (15 & SMAP_E3_TX_URG_REQ_MSK) << SMAP_E3_TX_URG_REQ_BITSFT);
-    SMAP_EMAC3_SET32(SMAP_R_EMAC3_RxMODE, SMAP_E3_RX_STRIP_PAD | SMAP_E3_RX_STRIP_FCS | SMAP_E3_RX_INDIVID_ADDR | SMAP_E3_RX_BCAST | SMAP_E3_RX_MCAST);
+    SetRxMode(emac3_regbase);
     SMAP_EMAC3_SET32(SMAP_R_EMAC3_INTR_STAT, SMAP_E3_INTR_TX_ERR_0 | SMAP_E3_INTR_SQE_ERR_0 | SMAP_E3_INTR_DEAD_0);
     SMAP_EMAC3_SET32(SMAP_R_EMAC3_INTR_ENABLE, SMAP_E3_INTR_TX_ERR_0 | SMAP_E3_INTR_SQE_ERR_0 | SMAP_E3_INTR_DEAD_0);
 
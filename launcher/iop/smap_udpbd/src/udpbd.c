@@ -5,14 +5,37 @@
 #include <smapregs.h>
 #include <dmacman.h>
 #include <dev9.h>
+#include <iomanX.h>
+#include <sysclib.h>
+#include <sysmem.h>
 
+#include "smap_udpbd.h"
 #include "udpbd.h"
 #include "ministack.h"
 #include "main.h"
+#include "xfer.h"
 #include "mprintf.h"
 
 #define UDPBD_MAX_RETRIES         4
 
+#define UDPBD_CACHE_LINE_SIZE     4096 // Bytes per cache line, must be a multiple of the sector size
+#define UDPBD_CACHE_BYPASS_SIZE   (16 * 1024) // Reads larger than this go straight to the caller's buffer
+#define UDPBD_CACHE_INVALID       0xffffffff
+#define UDPBD_READAHEAD_LINES     8 // Lines to prefetch once a sequential stream is detected
+#define UDPBD_SEQ_THRESHOLD       2 // Back-to-back reads needed to detect a sequential stream
+#define UDPBD_HINT_LOOKAHEAD      (1024 * 1024) // Bytes ahead of a sequential stream announced to the server
+#define UDPBD_SECTOR_SIZE         4096 // Logical sector size asked for when the server supports UDPBD_FEATURE_SECTOR_SIZE
+#define UDPBD_CLIENT_FEATURES     (UDPBD_FEATURE_HINT | UDPBD_FEATURE_SECTOR_SIZE | UDPBD_FEATURE_LARGE_XFER | UDPBD_FEATURE_GEOMETRY)
+
+#define UDPBD_CALIBRATE_SIZE      (32 * 1024) // Bytes per calibration read
+#define UDPBD_CALIBRATE_READS     2 // Calibration reads per geometry, every read is of sectors not read before
+#define UDPBD_GEOMETRY_ANY        0xffff // The server chooses the RDMA geometry
+#define UDPBD_GEOMETRY_TIMEOUT    50000  // usec to wait for GEOMETRY_ACK
+
+#define UDPBD_DISCOVER_MIN_DELAY  20    // ms before the first INFO retry, doubled after every retry
+#define UDPBD_DISCOVER_MAX_DELAY  1000  // ms
+#define UDPBD_DISCOVER_TIMEOUT    20000 // ms, overridden with the discover=<ms> module argument (0 = forever)
+
 
 struct SUDPBDv2_Header_Padded32 {
     union
@@ -34,6 +57,14 @@ typedef struct
     struct SUDPBDv2_Header bd;  //  2 bytes, offset +42 (0x2A)
 } __attribute__((packed, aligned(4))) udpbd_pkt_t;
 
+typedef struct
+{
+    eth_header_t eth;           // 14 bytes, offset + 0
+    ip_header_t ip;             // 20 bytes, offset +14 (0x0E)
+    udp_header_t udp;           //  8 bytes, offset +34 (0x22)
+    struct SUDPBDv2_InfoRequest info;
+} __attribute__((packed, aligned(4))) udpbd_pkt_info_t;
+
 typedef struct
 {
     eth_header_t eth;           // 14 bytes, offset + 0
@@ -42,6 +73,22 @@ typedef struct
     struct SUDPBDv2_RWRequest rw;
 } __attribute__((packed, aligned(4))) udpbd_pkt_rw_t;
 
+typedef struct
+{
+    eth_header_t eth;           // 14 bytes, offset + 0
+    ip_header_t ip;             // 20 bytes, offset +14 (0x0E)
+    udp_header_t udp;           //  8 bytes, offset +34 (0x22)
+    struct SUDPBDv2_Hint hint;
+} __attribute__((packed, aligned(4))) udpbd_pkt_hint_t;
+
+typedef struct
+{
+    eth_header_t eth;           // 14 bytes, offset + 0
+    ip_header_t ip;             // 20 bytes, offset +14 (0x0E)
+    udp_header_t udp;           //  8 bytes, offset +34 (0x22)
+    struct SUDPBDv2_Geometry geo;
+} __attribute__((packed, aligned(4))) udpbd_pkt_geometry_t;
+
 typedef struct
 {
     eth_header_t eth;           // 14 bytes, offset + 0
@@ -56,6 +103,7 @@ static struct block_device g_udpbd;
 static uint8_t g_cmdid   = 0;
 static int g_ev_done   = 0;
 static int g_read_cmdpkt = 0;
+static uint16_t g_read_done = 0; // Sectors a failed read got before the error
 static int bdm_connected = 0;
 static uint8_t *g_buffer = NULL;
 static uint8_t *g_buffer_act = NULL;
@@ -63,12 +111,67 @@ static unsigned int g_read_size;
 static int32_t g_errno = 0;
 static udp_socket_t *udpbd_socket = NULL;
 static int g_limit_dma_block_size = 0;
+static uint32_t g_features = 0;                        // Features negotiated with the server
+static uint16_t g_max_sectors = UDPBD_MAX_SECTOR_READ; // Maximum sectors per request
+static uint32_t g_server_ip = IP_ADDR(255,255,255,255); // Learned from INFO_REPLY, broadcast until then
+static unsigned int g_discover_timeout = UDPBD_DISCOVER_TIMEOUT;
+static unsigned int g_discover_delay = UDPBD_DISCOVER_MIN_DELAY;
+static uint32_t g_discover_start = 0;
+static int g_calibrate = 0; // Find the best RDMA geometry before the next read
+static uint16_t g_geo_shift = UDPBD_GEOMETRY_ANY; // RDMA geometry the server confirmed
+static uint16_t g_geo_count = 0;
+static uint16_t g_ack_shift = UDPBD_GEOMETRY_ANY; // RDMA geometry in the last GEOMETRY_ACK
+static uint16_t g_ack_count = 0;
+static int g_geo_lost = 0; // RDMA packets did not match g_geo_shift and g_geo_count
+
+struct udpbd_cache_line
+{
+    uint32_t sector; // First sector of the line, or UDPBD_CACHE_INVALID
+    uint32_t used;   // Value of g_cache_clock at last use, for LRU eviction
+};
+
+static unsigned int g_cache_size = UDPBD_CACHE_DEFAULT_SIZE * 1024;
+static uint8_t *g_cache_data = NULL;
+static struct udpbd_cache_line *g_cache_lines = NULL;
+static unsigned int g_cache_line_count = 0;
+static unsigned int g_cache_line_sectors = 0; // 0 when the cache is disabled
+static uint32_t g_cache_clock = 0;
+static uint64_t g_seq_next = 0;
+static unsigned int g_seq_count = 0;
+static uint64_t g_hint_end = 0; // End of the range last announced with UDPBD_CMD_HINT
+static struct udpbd_cache_stats g_cache_stats;
+static struct udpbd_io_stats g_io_stats;
+
+
+static unsigned int _udpbd_discover_alarm(void *arg)
+{
+    iSetEventFlag(SmapDriverData.Dev9IntrEventFlag, SMAP_EVENT_DISCOVER);
+    return 0;
+}
 
+static unsigned int _udpbd_ack_timeout(void *arg)
+{
+    iSetEventFlag(g_ev_done, 2);
+    return 0;
+}
+
+static void udpbd_hist_add(uint32_t *hist, uint32_t usec)
+{
+    unsigned int bucket = 0;
+
+    while (usec > 1 && bucket < (UDPBD_HIST_BUCKETS - 1)) {
+        usec >>= 1;
+        bucket++;
+    }
+    hist[bucket]++;
+}
 
 static unsigned int _udpbd_timeout(void *arg)
 {
     g_read_size = 0;
     g_errno     = 1;
+    g_io_stats.timeouts++;
+    smap_set_rx_poll(0);
     iSetEventFlag(g_ev_done, 2);
     return 0;
 }
@@ -79,6 +182,7 @@ static unsigned int _udpbd_timeout(void *arg)
 static int _udpbd_read(struct block_device *bd, uint64_t sector, void *buffer, uint16_t count)
 {
     uint32_t EFBits;
+    uint32_t start;
     iop_sys_clock_t clock;
     udpbd_pkt_rw_t pkt;
 
@@ -89,20 +193,32 @@ static int _udpbd_read(struct block_device *bd, uint64_t sector, void *buffer, u
     g_buffer_act    = buffer;
     g_read_size     = count * g_udpbd.sectorSize;
     g_read_cmdpkt   = 1; // First reply packet should be cmdpkt==1
+    g_read_done     = 0;
 
-    udp_packet_init((udp_packet_t *)&pkt, IP_ADDR(255,255,255,255), UDPBD_SERVER_PORT);
+    // Drop wakeups for an earlier command
+    ClearEventFlag(g_ev_done, 0);
+
+    udp_packet_init((udp_packet_t *)&pkt, g_server_ip, UDPBD_SERVER_PORT);
     pkt.rw.hdr.cmd    = UDPBD_CMD_READ;
     pkt.rw.hdr.cmdid  = g_cmdid;
     pkt.rw.hdr.cmdpkt = 0;
     pkt.rw.sector_count = count;
     pkt.rw.sector_nr = sector;
 
-    if (udp_packet_send(udpbd_socket, (udp_packet_t *)&pkt, sizeof(struct SUDPBDv2_RWRequest)) < 0)
+    // Many RDMA packets will follow, let the SMAP thread poll for them
+    smap_set_rx_poll(1);
+
+    g_io_stats.reads++;
+    start = smap_get_time_usec();
+
+    if (udp_packet_send(udpbd_socket, (udp_packet_t *)&pkt, sizeof(struct SUDPBDv2_RWRequest)) < 0) {
+        smap_set_rx_poll(0);
         return -1;
+    }
 
     // Set alarm in case something hangs
-    // 200ms + 2ms / sector
-    USec2SysClock((200 * 1000) + (count * 2000), &clock);
+    // 200ms + 2ms / 512 bytes
+    USec2SysClock((200 * 1000) + ((count * g_udpbd.sectorSize) >> 9) * 2000, &clock);
     SetAlarm(&clock, _udpbd_timeout, NULL);
 
     //wait for data...
@@ -111,6 +227,8 @@ static int _udpbd_read(struct block_device *bd, uint64_t sector, void *buffer, u
     // Cancel alarm
     CancelAlarm(_udpbd_timeout, NULL);
 
+    // Everything before the first missing packet is in the buffer, a retry can continue from there
+    g_read_done   = (g_buffer_act - g_buffer) / g_udpbd.sectorSize;
     g_buffer      = NULL;
     g_buffer_act  = NULL;
     g_read_size   = 0;
@@ -130,6 +248,9 @@ static int _udpbd_read(struct block_device *bd, uint64_t sector, void *buffer, u
         //case 3:
         //    M_DEBUG("%s(%d, %d): ERROR: invalid packet size!\n", __func__, sector, count);
         //    break;
+        //case 4:
+        //    M_DEBUG("%s(%d, %d): ERROR: DMA failed!\n", __func__, sector, count);
+        //    break;
         default:
             M_DEBUG("%s(%d, %d): ERROR: unknown %d\n", __func__, (uint32_t)sector, count, g_errno);
             break;
@@ -137,6 +258,8 @@ static int _udpbd_read(struct block_device *bd, uint64_t sector, void *buffer, u
 
     if (EFBits & 1)
     { // done
+        udpbd_hist_add(g_io_stats.read_hist, smap_get_time_usec() - start);
+        g_io_stats.bytes_read += count * g_udpbd.sectorSize;
         return count;
     }
 
@@ -144,31 +267,161 @@ static int _udpbd_read(struct block_device *bd, uint64_t sector, void *buffer, u
     return -EIO;
 }
 
-static int udpbd_read(struct block_device *bd, uint64_t sector, void *buffer, uint16_t count)
+// Sets the RDMA geometry of all following reads, and waits for the server to confirm it
+static int udpbd_set_geometry(uint16_t block_shift, uint16_t block_count)
 {
+    udpbd_pkt_geometry_t pkt;
+    iop_sys_clock_t clock;
+    uint32_t EFBits;
     int retries;
-    uint16_t count_left;
 
-    //M_DEBUG("%s: sector=%d, count=%d\n", __func__, (uint32_t)sector, count);
+    for (retries = 0; retries < UDPBD_MAX_RETRIES; retries++) {
+        g_cmdid     = (g_cmdid + 1) & 0x7;
+        g_ack_shift = UDPBD_GEOMETRY_ANY;
+        ClearEventFlag(g_ev_done, 0);
+
+        udp_packet_init((udp_packet_t *)&pkt, g_server_ip, UDPBD_SERVER_PORT);
+        pkt.geo.hdr.cmd     = UDPBD_CMD_GEOMETRY;
+        pkt.geo.hdr.cmdid   = g_cmdid;
+        pkt.geo.hdr.cmdpkt  = 0;
+        pkt.geo.block_shift = block_shift;
+        pkt.geo.block_count = block_count;
+        if (udp_packet_send(udpbd_socket, (udp_packet_t *)&pkt, sizeof(struct SUDPBDv2_Geometry)) < 0)
+            continue;
+
+        USec2SysClock(UDPBD_GEOMETRY_TIMEOUT, &clock);
+        SetAlarm(&clock, _udpbd_ack_timeout, NULL);
+        WaitEventFlag(g_ev_done, 2 | 1, WEF_OR | WEF_CLEAR, &EFBits);
+        CancelAlarm(_udpbd_ack_timeout, NULL);
 
-    if (bdm_connected == 0)
-        return -EIO;
+        // The server replies with the geometry it uses, which is the old one if it refused the new one
+        if (EFBits & 1) {
+            if (g_ack_shift != block_shift || g_ack_count != block_count)
+                break;
+            g_geo_shift = block_shift;
+            g_geo_count = block_count;
+            g_geo_lost  = 0;
+            return 0;
+        }
+    }
 
-    if (sector >= bd->sectorCount)
-        return -EINVAL;
+    // Unknown, stop checking RDMA packets against it
+    g_geo_shift = UDPBD_GEOMETRY_ANY;
+    return -1;
+}
 
-    if ((sector + count) > bd->sectorCount)
-        count = bd->sectorCount - sector;
+// Times a few reads with every candidate RDMA geometry, and keeps the fastest one
+static void udpbd_calibrate(struct block_device *bd)
+{
+    // Block size and blocks per packet: 1408 bytes per packet in 64 to 512 byte blocks,
+    // or fewer blocks for servers and networks that do better with smaller packets
+    static const struct {
+        uint8_t shift;
+        uint8_t count;
+    } geometries[] = {{4, 0}, {5, 0}, {6, 0}, {7, 0}, {5, 8}, {7, 2}};
+    uint32_t start = smap_get_time_usec();
+    uint32_t best_time = 0xffffffff;
+    uint16_t count = UDPBD_CALIBRATE_SIZE / bd->sectorSize;
+    uint32_t total = count * UDPBD_CALIBRATE_READS * (sizeof(geometries) / sizeof(geometries[0]));
+    uint32_t sector;
+    unsigned int i, j;
+    int best = -1;
+    void *buffer;
+    struct udpbd_io_stats saved_stats;
+
+    g_calibrate = 0;
+
+    if (count == 0 || count > g_max_sectors || total > bd->sectorCount)
+        return;
+    if ((buffer = AllocSysMemory(ALLOC_FIRST, UDPBD_CALIBRATE_SIZE, NULL)) == NULL)
+        return;
+
+    // Calibration reads are not part of the transfer summary
+    saved_stats = g_io_stats;
+
+    // Read sectors the server is unlikely to have cached, and never the same sectors twice,
+    // so every geometry is timed on what a real read costs
+    sector = bd->sectorCount / 2;
+    if (sector + total > bd->sectorCount)
+        sector = bd->sectorCount - total;
+
+    for (i = 0; i < sizeof(geometries) / sizeof(geometries[0]); i++) {
+        uint32_t t;
+
+        // Older SPEED chips split blocks larger than 128 bytes, which only adds overhead
+        if (g_limit_dma_block_size == 1 && geometries[i].shift > 5)
+            continue;
+
+        if (udpbd_set_geometry(geometries[i].shift, geometries[i].count) < 0) {
+            M_DEBUG("calibrate: %d x %d byte blocks: not confirmed\n", geometries[i].count, 1U << (geometries[i].shift + 2));
+            continue;
+        }
+
+        t = smap_get_time_usec();
+        for (j = 0; j < UDPBD_CALIBRATE_READS; j++, sector += count) {
+            if (_udpbd_read(bd, sector, buffer, count) != count)
+                break;
+        }
+        t = smap_get_time_usec() - t;
+        M_DEBUG("calibrate: %d x %d byte blocks: %dus%s\n", geometries[i].count, 1U << (geometries[i].shift + 2), t,
+                (j < UDPBD_CALIBRATE_READS) ? " (failed)" : "");
+
+        if (j == UDPBD_CALIBRATE_READS && t < best_time) {
+            best_time = t;
+            best      = i;
+        }
+    }
+
+    FreeSysMemory(buffer);
+
+    // Fall back to 128 byte blocks, known to work on every SPEED revision
+    if (best >= 0 && udpbd_set_geometry(geometries[best].shift, geometries[best].count) == 0)
+        smap_link_stats.rdma_block_size = 1U << (geometries[best].shift + 2);
+    else if (udpbd_set_geometry(5, 0) == 0)
+        smap_link_stats.rdma_block_size = 128;
+    else
+        smap_link_stats.rdma_block_size = 0;
+    g_io_stats = saved_stats;
+    smap_link_stats.calibration_time = smap_get_time_usec() - start;
+    M_DEBUG("calibrate: using %d byte blocks\n", smap_link_stats.rdma_block_size);
+}
+
+static int udpbd_read_sectors(struct block_device *bd, uint64_t sector, void *buffer, uint16_t count)
+{
+    int retries;
+    uint16_t count_left;
+
+    if (g_calibrate)
+        udpbd_calibrate(bd);
+    else if (g_geo_lost) {
+        // The server forgot the geometry, e.g. after a restart
+        g_io_stats.geometry_resends++;
+        if (udpbd_set_geometry(g_geo_shift, g_geo_count) < 0)
+            smap_link_stats.rdma_block_size = 0;
+    }
 
     count_left = count;
     while (count_left > 0)
     {
-        uint16_t count_block = count_left > UDPBD_MAX_SECTOR_READ ? UDPBD_MAX_SECTOR_READ : count_left;
+        uint16_t count_block = count_left > g_max_sectors ? g_max_sectors : count_left;
 
         for (retries = 0; retries < UDPBD_MAX_RETRIES; retries++)
         {
+            if (retries > 0)
+                g_io_stats.retries++;
             if (_udpbd_read(bd, sector, buffer, count_block) == count_block)
                 break;
+
+            // Keep what was received in order, and only count a retry that made no progress
+            if (g_read_done > 0 && g_read_done < count_block) {
+                count_left  -= g_read_done;
+                count_block -= g_read_done;
+                sector      += g_read_done;
+                buffer      += g_read_done * g_udpbd.sectorSize;
+                retries--;
+            }
+            // The server may be trying to resolve our MAC, let its ARP requests through
+            smap_set_rx_broadcast(1);
             DelayThread(1000);
         }
 
@@ -177,8 +430,18 @@ static int udpbd_read(struct block_device *bd, uint64_t sector, void *buffer, ui
             M_DEBUG("%s: too many errors, disconnecting\n", __func__);
             bdm_disconnect_bd(&g_udpbd);
             bdm_connected = 0;
+            g_server_ip   = IP_ADDR(255,255,255,255);
+            g_io_stats.disconnects++;
+
+            // Look for the server again, from the SMAP thread
+            g_discover_delay = UDPBD_DISCOVER_MIN_DELAY;
+            g_discover_start = smap_get_time_usec();
+            smap_link_stats.discovery_time = 0;
+            SetEventFlag(SmapDriverData.Dev9IntrEventFlag, SMAP_EVENT_DISCOVER);
             return -EIO;
         }
+        if (retries > 0)
+            smap_set_rx_broadcast(0);
 
         count_left -= count_block;
         sector += count_block;
@@ -188,9 +451,10 @@ static int udpbd_read(struct block_device *bd, uint64_t sector, void *buffer, ui
     return count;
 }
 
-static int udpbd_write(struct block_device *bd, uint64_t sector, const void *buffer, uint16_t count)
+static int udpbd_write_sectors(struct block_device *bd, uint64_t sector, const void *buffer, uint16_t count)
 {
     uint32_t EFBits;
+    uint32_t start;
 
     M_DEBUG("%s: sector=%d, count=%d\n", __func__, (uint32_t)sector, count);
 
@@ -204,11 +468,16 @@ static int udpbd_write(struct block_device *bd, uint64_t sector, const void *buf
         count = bd->sectorCount - sector;
 
     g_cmdid = (g_cmdid + 1) & 0x7;
+    g_io_stats.writes++;
+    start = smap_get_time_usec();
+
+    // Drop wakeups for an earlier command
+    ClearEventFlag(g_ev_done, 0);
 
     // Send write command
     {
         udpbd_pkt_rw_t pkt;
-        udp_packet_init((udp_packet_t *)&pkt, IP_ADDR(255,255,255,255), UDPBD_SERVER_PORT);
+        udp_packet_init((udp_packet_t *)&pkt, g_server_ip, UDPBD_SERVER_PORT);
         pkt.rw.hdr.cmd    = UDPBD_CMD_WRITE;
         pkt.rw.hdr.cmdid  = g_cmdid;
         pkt.rw.hdr.cmdpkt = 0;
@@ -223,22 +492,27 @@ static int udpbd_write(struct block_device *bd, uint64_t sector, const void *buf
 
     // Send data
     {
-        uint16_t count_left = count;
+        // Servers without UDPBD_FEATURE_LARGE_XFER expect 512 bytes per packet
+        uint32_t packet_size = (g_features & UDPBD_FEATURE_LARGE_XFER) ? 1408 : 512;
+        uint32_t size_left = count * g_udpbd.sectorSize;
         udpbd_pkt_rdma_t pkt;
-        udp_packet_init((udp_packet_t *)&pkt, IP_ADDR(255,255,255,255), UDPBD_SERVER_PORT);
+        udp_packet_init((udp_packet_t *)&pkt, g_server_ip, UDPBD_SERVER_PORT);
         pkt.hdr.cmd    = UDPBD_CMD_WRITE_RDMA;
         pkt.hdr.cmdid  = g_cmdid;
         pkt.hdr.cmdpkt = 0;
-        pkt.bt.block_count = 4; // 4 x 128b = 512b
         pkt.bt.block_shift = 5; // 128 byte blocks
 
-        while (count_left--) {
+        while (size_left > 0) {
+            uint32_t size = size_left > packet_size ? packet_size : size_left;
+
             pkt.hdr.cmdpkt++;
-            if (udp_packet_send_ll(udpbd_socket, (udp_packet_t *)&pkt, sizeof(struct SUDPBDv2_Header) + sizeof(union block_type), buffer, 512) < 0) {
+            pkt.bt.block_count = size >> 7;
+            if (udp_packet_send_ll(udpbd_socket, (udp_packet_t *)&pkt, sizeof(struct SUDPBDv2_Header) + sizeof(union block_type), buffer, size) < 0) {
                 M_DEBUG("%s(%d, %d): ERROR\n", __func__, (uint32_t)sector, count);
                 return -1;
             }
-            buffer = (const uint8_t *)buffer + 512;
+            buffer = (const uint8_t *)buffer + size;
+            size_left -= size;
         }
     }
 
@@ -247,8 +521,8 @@ static int udpbd_write(struct block_device *bd, uint64_t sector, const void *buf
         iop_sys_clock_t clock;
 
         // Set alarm in case something hangs
-        // 200ms
-        USec2SysClock((200 * 1000), &clock);
+        // 200ms + 2ms / 512 bytes
+        USec2SysClock((200 * 1000) + ((count * g_udpbd.sectorSize) >> 9) * 2000, &clock);
         SetAlarm(&clock, _udpbd_timeout, NULL);
 
         //wait for done...
@@ -279,6 +553,8 @@ static int udpbd_write(struct block_device *bd, uint64_t sector, const void *buf
 
     if (EFBits & 1)
     { // done
+        udpbd_hist_add(g_io_stats.write_hist, smap_get_time_usec() - start);
+        g_io_stats.bytes_written += count * g_udpbd.sectorSize;
         return count;
     }
 
@@ -287,6 +563,256 @@ static int udpbd_write(struct block_device *bd, uint64_t sector, const void *buf
     return -EIO;
 }
 
+static void udpbd_send_hint(uint32_t sector, uint32_t count, uint16_t pattern)
+{
+    udpbd_pkt_hint_t pkt;
+
+    udp_packet_init((udp_packet_t *)&pkt, g_server_ip, UDPBD_SERVER_PORT);
+    pkt.hint.hdr.cmd      = UDPBD_CMD_HINT;
+    pkt.hint.hdr.cmdid    = g_cmdid;
+    pkt.hint.hdr.cmdpkt   = 0;
+    pkt.hint.sector_nr    = sector;
+    pkt.hint.sector_count = count;
+    pkt.hint.pattern      = pattern;
+    udp_packet_send(udpbd_socket, (udp_packet_t *)&pkt, sizeof(struct SUDPBDv2_Hint));
+}
+
+//
+// Sector cache
+//
+static inline uint8_t *udpbd_cache_line_data(struct udpbd_cache_line *line)
+{
+    return g_cache_data + (line - g_cache_lines) * UDPBD_CACHE_LINE_SIZE;
+}
+
+static void udpbd_cache_invalidate(void)
+{
+    unsigned int i;
+
+    for (i = 0; i < g_cache_line_count; i++) {
+        g_cache_lines[i].sector = UDPBD_CACHE_INVALID;
+        g_cache_lines[i].used   = 0;
+    }
+}
+
+static void udpbd_cache_alloc(void)
+{
+    unsigned int count = g_cache_size / UDPBD_CACHE_LINE_SIZE;
+
+    if (g_cache_data != NULL || count == 0)
+        return;
+
+    g_cache_data = AllocSysMemory(ALLOC_FIRST, count * (UDPBD_CACHE_LINE_SIZE + sizeof(struct udpbd_cache_line)), NULL);
+    if (g_cache_data == NULL) {
+        M_DEBUG("%s: failed to allocate %d lines\n", __func__, count);
+        return;
+    }
+
+    g_cache_lines = (struct udpbd_cache_line *)(g_cache_data + count * UDPBD_CACHE_LINE_SIZE);
+    g_cache_line_count = count;
+    udpbd_cache_invalidate();
+    M_DEBUG("cache: %d x %d bytes\n", count, UDPBD_CACHE_LINE_SIZE);
+}
+
+static struct udpbd_cache_line *udpbd_cache_find(uint32_t line_sector)
+{
+    unsigned int i;
+
+    for (i = 0; i < g_cache_line_count; i++) {
+        if (g_cache_lines[i].sector == line_sector)
+            return &g_cache_lines[i];
+    }
+
+    return NULL;
+}
+
+// Reads nlines consecutive lines starting at line_sector into the least recently used run of lines
+static int udpbd_cache_fill(struct block_device *bd, uint32_t line_sector, unsigned int nlines)
+{
+    struct udpbd_cache_line *line;
+    unsigned int start, best, i;
+    uint32_t newest, best_age;
+    uint64_t count;
+
+    if (nlines > g_cache_line_count)
+        nlines = g_cache_line_count;
+
+    // Never read past the end of the device
+    count = (uint64_t)nlines * g_cache_line_sectors;
+    if (line_sector + count > bd->sectorCount) {
+        count  = bd->sectorCount - line_sector;
+        nlines = (count + g_cache_line_sectors - 1) / g_cache_line_sectors;
+    }
+
+    // Drop lines that are about to be fetched again, so a sector is never cached twice
+    for (i = 0; i < nlines; i++) {
+        line = udpbd_cache_find(line_sector + i * g_cache_line_sectors);
+        if (line != NULL) {
+            line->sector = UDPBD_CACHE_INVALID;
+            line->used   = 0;
+        }
+    }
+
+    // The victim is the run of lines whose most recent use is the oldest
+    best     = 0;
+    best_age = 0xffffffff;
+    for (start = 0; start + nlines <= g_cache_line_count; start++) {
+        newest = 0;
+        for (i = start; i < start + nlines; i++) {
+            if (g_cache_lines[i].used > newest)
+                newest = g_cache_lines[i].used;
+        }
+        if (newest < best_age) {
+            best_age = newest;
+            best     = start;
+        }
+    }
+
+    for (i = best; i < best + nlines; i++) {
+        if (g_cache_lines[i].sector != UDPBD_CACHE_INVALID)
+            g_cache_stats.evictions++;
+        g_cache_lines[i].sector = UDPBD_CACHE_INVALID;
+    }
+
+    if (udpbd_read_sectors(bd, line_sector, udpbd_cache_line_data(&g_cache_lines[best]), count) != count)
+        return -EIO;
+
+    for (i = 0; i < nlines; i++) {
+        g_cache_lines[best + i].sector = line_sector + i * g_cache_line_sectors;
+        g_cache_lines[best + i].used   = ++g_cache_clock;
+    }
+    g_cache_stats.prefetched += (nlines - 1) * g_cache_line_sectors;
+
+    return 0;
+}
+
+// Copies written sectors into the lines that hold them, or drops those lines if the write failed
+static void udpbd_cache_write(uint64_t sector, const void *buffer, uint16_t count, int valid)
+{
+    struct udpbd_cache_line *line;
+    uint32_t line_sector, offset, n;
+
+    while (count > 0) {
+        line_sector = sector & ~(uint64_t)(g_cache_line_sectors - 1);
+        offset = sector - line_sector;
+        n = g_cache_line_sectors - offset;
+        if (n > count)
+            n = count;
+
+        line = udpbd_cache_find(line_sector);
+        if (line != NULL) {
+            if (valid)
+                memcpy(udpbd_cache_line_data(line) + offset * g_udpbd.sectorSize, buffer, n * g_udpbd.sectorSize);
+            else
+                line->sector = UDPBD_CACHE_INVALID;
+        }
+
+        count  -= n;
+        sector += n;
+        buffer  = (const uint8_t *)buffer + n * g_udpbd.sectorSize;
+    }
+}
+
+static int udpbd_read(struct block_device *bd, uint64_t sector, void *buffer, uint16_t count)
+{
+    struct udpbd_cache_line *line;
+    uint32_t line_sector, offset, n;
+    uint16_t count_left;
+    int sequential;
+
+    //M_DEBUG("%s: sector=%d, count=%d\n", __func__, (uint32_t)sector, count);
+
+    if (bdm_connected == 0)
+        return -EIO;
+
+    if (sector >= bd->sectorCount)
+        return -EINVAL;
+
+    if ((sector + count) > bd->sectorCount)
+        count = bd->sectorCount - sector;
+
+    // Track back-to-back reads to detect sequential streams
+    if (sector == g_seq_next) {
+        if (g_seq_count < UDPBD_SEQ_THRESHOLD)
+            g_seq_count++;
+    } else {
+        g_seq_count = 0;
+        g_hint_end  = 0;
+    }
+    g_seq_next = sector + count;
+    sequential = (g_seq_count >= UDPBD_SEQ_THRESHOLD);
+
+    // Keep the server at least half a lookahead window ahead of the stream
+    if (sequential && (g_features & UDPBD_FEATURE_HINT)) {
+        uint64_t lookahead = UDPBD_HINT_LOOKAHEAD / bd->sectorSize;
+
+        if (g_hint_end < g_seq_next + lookahead / 2) {
+            uint64_t start = (g_hint_end > g_seq_next) ? g_hint_end : g_seq_next;
+            uint64_t end   = g_seq_next + lookahead;
+            if (end > bd->sectorCount)
+                end = bd->sectorCount;
+            if (start < end) {
+                udpbd_send_hint(start, end - start, UDPBD_HINT_SEQUENTIAL);
+                g_hint_end = end;
+            }
+        }
+    }
+
+    // Large reads gain nothing from the cache and would only flush it
+    if (g_cache_line_sectors == 0 || (count * bd->sectorSize) > UDPBD_CACHE_BYPASS_SIZE)
+        return udpbd_read_sectors(bd, sector, buffer, count);
+
+    count_left = count;
+    while (count_left > 0) {
+        line_sector = sector & ~(uint64_t)(g_cache_line_sectors - 1);
+        offset = sector - line_sector;
+        n = g_cache_line_sectors - offset;
+        if (n > count_left)
+            n = count_left;
+
+        line = udpbd_cache_find(line_sector);
+        if (line == NULL) {
+            g_cache_stats.misses += n;
+            if (udpbd_cache_fill(bd, line_sector, sequential ? UDPBD_READAHEAD_LINES : 1) < 0)
+                return -EIO;
+            line = udpbd_cache_find(line_sector);
+        } else {
+            g_cache_stats.hits += n;
+            line->used = ++g_cache_clock;
+        }
+
+        memcpy(buffer, udpbd_cache_line_data(line) + offset * bd->sectorSize, n * bd->sectorSize);
+
+        count_left -= n;
+        sector += n;
+        buffer = (uint8_t *)buffer + n * bd->sectorSize;
+    }
+
+    return count;
+}
+
+static int udpbd_write(struct block_device *bd, uint64_t sector, const void *buffer, uint16_t count)
+{
+    uint16_t count_left = count;
+    int result;
+
+    do {
+        uint16_t count_block = count_left > g_max_sectors ? g_max_sectors : count_left;
+
+        result = udpbd_write_sectors(bd, sector, buffer, count_block);
+        if (g_cache_line_sectors != 0 && result != -EINVAL)
+            udpbd_cache_write(sector, buffer, (result > 0) ? result : count_block, result > 0);
+        if (result != count_block)
+            return (result < 0) ? result : count - count_left + result;
+
+        count_left -= count_block;
+        sector += count_block;
+        buffer = (const uint8_t *)buffer + count_block * bd->sectorSize;
+    } while (count_left > 0);
+
+    return count;
+}
+
 static void udpbd_flush(struct block_device *bd)
 {
     M_DEBUG("%s\n", __func__);
@@ -299,13 +825,57 @@ static int udpbd_stop(struct block_device *bd)
     return 0;
 }
 
-static inline void _cmd_info_reply(struct SUDPBDv2_Header *hdr)
+static inline void _cmd_info_reply(struct SUDPBDv2_Header *hdr, uint16_t size, const ms_rx_header_t *rx)
 {
     if (bdm_connected == 0)
     {
         USE_SMAP_REGS;
         g_udpbd.sectorSize  = SMAP_REG32(SMAP_R_RXFIFO_DATA);
         g_udpbd.sectorCount = SMAP_REG32(SMAP_R_RXFIFO_DATA);
+
+        // Servers that don't negotiate send the sector size and count only
+        g_features    = 0;
+        g_max_sectors = UDPBD_MAX_SECTOR_READ;
+        if (size >= sizeof(struct SUDPBDv2_InfoReply)) {
+            uint32_t version  = SMAP_REG32(SMAP_R_RXFIFO_DATA); // version | max_sectors << 16
+            uint32_t features = SMAP_REG32(SMAP_R_RXFIFO_DATA);
+
+            if ((version & 0xffff) >= 1) {
+                g_features = features & UDPBD_CLIENT_FEATURES;
+                if ((g_features & UDPBD_FEATURE_LARGE_XFER) && (version >> 16) != 0)
+                    g_max_sectors = version >> 16;
+            }
+        }
+        M_DEBUG("server: %d byte sectors, %d sectors/request, features 0x%x\n", g_udpbd.sectorSize, g_max_sectors, g_features);
+
+        // Calibrate on the first read, the SMAP thread can not wait for replies
+        g_calibrate = (g_features & UDPBD_FEATURE_GEOMETRY) ? 1 : 0;
+        g_geo_shift = UDPBD_GEOMETRY_ANY;
+        g_geo_lost  = 0;
+        smap_link_stats.rdma_block_size  = 0;
+        smap_link_stats.calibration_time = 0;
+
+        // Learn the server addresses, all further traffic is unicast
+        {
+            const uint8_t *ip = rx->ip.addr_src.addr;
+
+            g_server_ip = IP_ADDR(ip[0], ip[1], ip[2], ip[3]);
+            arp_add_entry(g_server_ip, (uint8_t *)rx->eth.addr_src);
+            smap_set_rx_broadcast(0);
+            M_DEBUG("server: %d.%d.%d.%d\n", ip[0], ip[1], ip[2], ip[3]);
+        }
+
+        // The cache only works with power-of-two sectors that fit in a line
+        g_cache_line_sectors = 0;
+        if (g_cache_line_count > 0 && g_udpbd.sectorSize > 0 && g_udpbd.sectorSize <= UDPBD_CACHE_LINE_SIZE &&
+            (g_udpbd.sectorSize & (g_udpbd.sectorSize - 1)) == 0)
+            g_cache_line_sectors = UDPBD_CACHE_LINE_SIZE / g_udpbd.sectorSize;
+        udpbd_cache_invalidate();
+
+        CancelAlarm(_udpbd_discover_alarm, NULL);
+        smap_link_stats.discovery_time = smap_get_time_usec() - g_discover_start;
+        M_DEBUG("server found after %dms, %d requests\n", smap_link_stats.discovery_time / 1000, smap_link_stats.discovery_tries);
+
         bdm_connected = 1;
         bdm_connect_bd(&g_udpbd);
     }
@@ -320,17 +890,26 @@ static inline void _cmd_read_rdma(struct SUDPBDv2_Header *hdr)
     bt.bt = SMAP_REG32(SMAP_R_RXFIFO_DATA);
     size = bt.block_count << (bt.block_shift + 2);
 
-    if (g_buffer == NULL) {
+    // Late packets for a read that already completed or failed
+    if (g_buffer == NULL || g_read_size == 0) {
         M_DEBUG("%s: unexpected packet (cmd %d, cmdid %d, cmdpkt %d)\n", __func__, hdr->cmd, hdr->cmdid, hdr->cmdpkt);
         return;
     }
 
-    // Validate packet order
+    // Packets that were already received, duplicated or retransmitted on the way
+    if ((uint8_t)(g_read_cmdpkt - hdr->cmdpkt - 1) < 0x80) {
+        g_io_stats.duplicates++;
+        return;
+    }
+
+    // Validate packet order, a gap means a packet was lost
     if (hdr->cmdpkt != (g_read_cmdpkt & 0xff))
     {
         // Error, wakeup caller
         g_read_size = 0;
         g_errno     = 2;
+        g_io_stats.bad_cmdpkt++;
+        smap_set_rx_poll(0);
         M_DEBUG("%s: invalid cmdpkt (cmd %d, cmdid %d, cmdpkt %d != %d)\n", __func__, hdr->cmd, hdr->cmdid, hdr->cmdpkt, g_read_cmdpkt);
         SetEventFlag(g_ev_done, 2);
         return;
@@ -343,11 +922,17 @@ static inline void _cmd_read_rdma(struct SUDPBDv2_Header *hdr)
         // Error, wakeup caller
         g_read_size = 0;
         g_errno     = 3;
+        g_io_stats.bad_size++;
+        smap_set_rx_poll(0);
         M_DEBUG("%s: invalid size %d\n", __func__, size);
         SetEventFlag(g_ev_done, 2);
         return;
     }
 
+    // RDMA packets in a different geometry than confirmed, set it again before the next read
+    if (g_geo_shift != UDPBD_GEOMETRY_ANY && (bt.block_shift != g_geo_shift || (g_geo_count != 0 && bt.block_count > g_geo_count)))
+        g_geo_lost = 1;
+
     // Workaround for older SPEED chips, limit block sizze to 128 bytes
     if (g_limit_dma_block_size == 1) {
         while (bt.block_shift > 5) {
@@ -357,13 +942,24 @@ static inline void _cmd_read_rdma(struct SUDPBDv2_Header *hdr)
     }
 
     // Directly DMA the packet data into the user buffer
-    dev9DmaTransfer(1, g_buffer_act, bt.block_count << 16 | (1U << bt.block_shift), DMAC_TO_MEM);
+    if (dev9DmaTransfer(1, g_buffer_act, bt.block_count << 16 | (1U << bt.block_shift), DMAC_TO_MEM) < 0)
+    {
+        // Error, wakeup caller
+        g_read_size = 0;
+        g_errno     = 4;
+        g_io_stats.dma_errors++;
+        smap_set_rx_poll(0);
+        M_DEBUG("%s: DMA error (%d x %d)\n", __func__, bt.block_count, 1U << (bt.block_shift + 2));
+        SetEventFlag(g_ev_done, 2);
+        return;
+    }
 
     g_buffer_act += size;
     g_read_size -= size;
     if (g_read_size == 0)
     {
         // Done, wakeup caller
+        smap_set_rx_poll(0);
         SetEventFlag(g_ev_done, 1);
         return;
     }
@@ -374,20 +970,41 @@ static inline void _cmd_write_done(struct SUDPBDv2_Header *hdr)
     USE_SMAP_REGS;
     int32_t result = SMAP_REG32(SMAP_R_RXFIFO_DATA);
 
+    if (result < 0)
+        g_io_stats.write_errors++;
+
     // Done, wakeup caller
     SetEventFlag(g_ev_done, (result >= 0) ? 1 : 2);
     return;
 }
 
-static int udpbd_isr(udp_socket_t *socket, uint16_t pointer, void *arg)
+static inline void _cmd_geometry_ack(struct SUDPBDv2_Header *hdr, uint16_t size)
 {
     USE_SMAP_REGS;
+    uint32_t geo;
+
+    if (size < sizeof(struct SUDPBDv2_Geometry))
+        return;
+
+    geo = SMAP_REG32(SMAP_R_RXFIFO_DATA); // block_shift | block_count << 16
+    g_ack_shift = geo & 0xffff;
+    g_ack_count = geo >> 16;
+
+    // Done, wakeup caller
+    SetEventFlag(g_ev_done, 1);
+}
+
+static int udpbd_isr(udp_socket_t *socket, const ms_rx_header_t *rx, void *arg)
+{
     struct SUDPBDv2_Header_Padded32 hdr32;
+    uint16_t size;
 
-    SMAP_REG16(SMAP_R_RXFIFO_RD_PTR) = pointer + 0x28;
-    hdr32.cmd32 = SMAP_REG32(SMAP_R_RXFIFO_DATA);
+    // The FIFO is positioned right after the UDPBD header (+0x2C), handlers continue reading from there
+    size = ntohs(rx->udp.len) - sizeof(udp_header_t);
+    hdr32.cmd32 = rx->w[10];
 
     if (hdr32.hdr.cmdid != g_cmdid) {
+        g_io_stats.stale++;
         M_DEBUG("%s: unexpected packet (cmd %d, cmdid %d, cmdpkt %d)\n", __func__, hdr32.hdr.cmd, hdr32.hdr.cmdid, hdr32.hdr.cmdpkt);
         return 0;
     }
@@ -395,7 +1012,7 @@ static int udpbd_isr(udp_socket_t *socket, uint16_t pointer, void *arg)
     switch (hdr32.hdr.cmd)
     {
         case UDPBD_CMD_INFO_REPLY:
-            _cmd_info_reply(&hdr32.hdr);
+            _cmd_info_reply(&hdr32.hdr, size, rx);
             break;
         case UDPBD_CMD_READ_RDMA:
             _cmd_read_rdma(&hdr32.hdr);
@@ -403,6 +1020,9 @@ static int udpbd_isr(udp_socket_t *socket, uint16_t pointer, void *arg)
         case UDPBD_CMD_WRITE_DONE:
             _cmd_write_done(&hdr32.hdr);
             break;
+        case UDPBD_CMD_GEOMETRY_ACK:
+            _cmd_geometry_ack(&hdr32.hdr, size);
+            break;
         default:
             M_DEBUG("%s: invalid (cmd %d, cmdid %d, cmdpkt %d)\n", __func__, hdr32.hdr.cmd, hdr32.hdr.cmdid, hdr32.hdr.cmdpkt);
     };
@@ -410,13 +1030,151 @@ static int udpbd_isr(udp_socket_t *socket, uint16_t pointer, void *arg)
     return 0;
 }
 
+//
+// Statistics device
+//
+static int dummy_m5() { return -5; }
+static int dummy_0()  { return 0; }
+
+static int udpbd_dev_devctl(iop_file_t *f, const char *name, int cmd, void *arg, unsigned int arglen, void *buf, unsigned int buflen)
+{
+    switch (cmd)
+    {
+        case UDPBD_DEVCTL_GET_CACHE_STATS:
+            if (buflen < sizeof(struct udpbd_cache_stats))
+                return -EINVAL;
+            g_cache_stats.lines     = (g_cache_line_sectors != 0) ? g_cache_line_count : 0;
+            g_cache_stats.line_size = UDPBD_CACHE_LINE_SIZE;
+            memcpy(buf, &g_cache_stats, sizeof(struct udpbd_cache_stats));
+            return 0;
+        case UDPBD_DEVCTL_GET_RX_STATS:
+            if (buflen < sizeof(struct smap_rx_stats))
+                return -EINVAL;
+            memcpy(buf, &smap_rx_stats, sizeof(struct smap_rx_stats));
+            return 0;
+        case UDPBD_DEVCTL_GET_LINK_STATS:
+            if (buflen < sizeof(struct smap_link_stats))
+                return -EINVAL;
+            memcpy(buf, &smap_link_stats, sizeof(struct smap_link_stats));
+            return 0;
+        case UDPBD_DEVCTL_GET_TX_STATS:
+            if (buflen < sizeof(struct smap_tx_stats))
+                return -EINVAL;
+            memcpy(buf, &smap_tx_stats, sizeof(struct smap_tx_stats));
+            return 0;
+        case UDPBD_DEVCTL_GET_IO_STATS:
+            if (buflen < sizeof(struct udpbd_io_stats))
+                return -EINVAL;
+            memcpy(buf, &g_io_stats, sizeof(struct udpbd_io_stats));
+            return 0;
+        case UDPBD_DEVCTL_RESET_STATS:
+            memset(&g_cache_stats, 0, sizeof(struct udpbd_cache_stats));
+            memset(&g_io_stats, 0, sizeof(struct udpbd_io_stats));
+            memset(&smap_rx_stats, 0, sizeof(struct smap_rx_stats));
+            memset(&smap_tx_stats, 0, sizeof(struct smap_tx_stats));
+            return 0;
+        default:
+            return -EINVAL;
+    }
+}
+
+static iop_device_ops_t udpbd_dev_functarray = {
+    (void *)dummy_0,  // init
+    (void *)dummy_0,  // deinit
+    (void *)dummy_m5, // format
+    (void *)dummy_m5, // open
+    (void *)dummy_m5, // close
+    (void *)dummy_m5, // read
+    (void *)dummy_m5, // write
+    (void *)dummy_m5, // lseek
+    (void *)dummy_m5, // ioctl
+    (void *)dummy_m5, // remove
+    (void *)dummy_m5, // mkdir
+    (void *)dummy_m5, // rmdir
+    (void *)dummy_m5, // dopen
+    (void *)dummy_m5, // dclose
+    (void *)dummy_m5, // dread
+    (void *)dummy_m5, // getstat
+    (void *)dummy_m5, // chstat
+    (void *)dummy_m5, // rename
+    (void *)dummy_m5, // chdir
+    (void *)dummy_m5, // sync
+    (void *)dummy_m5, // mount
+    (void *)dummy_m5, // umount
+    (void *)dummy_m5, // lseek64
+    udpbd_dev_devctl,
+    (void *)dummy_m5, // symlink
+    (void *)dummy_m5, // readlink
+    (void *)dummy_m5, // ioctl2
+};
+
+static iop_device_t udpbd_dev = {
+    UDPBD_DEVNAME,
+    IOP_DT_FS | IOP_DT_FSEXT,
+    1,
+    "UDPBD statistics",
+    &udpbd_dev_functarray};
+
 //
 // Public functions
 //
+void udpbd_set_cache_size(unsigned int kib)
+{
+    g_cache_size = kib * 1024;
+}
+
+void udpbd_set_discover_timeout(unsigned int ms)
+{
+    g_discover_timeout = ms;
+}
+
+// Broadcasts a request for block device information, and schedules the next one
+void udpbd_discover(void)
+{
+    udpbd_pkt_info_t pkt;
+    iop_sys_clock_t clock;
+
+    if (bdm_connected != 0)
+        return;
+
+    if (g_discover_timeout != 0 && (smap_get_time_usec() - g_discover_start) >= g_discover_timeout * 1000) {
+        M_DEBUG("no server found in %dms\n", g_discover_timeout);
+        return;
+    }
+
+    udp_packet_init((udp_packet_t *)&pkt, IP_ADDR(255,255,255,255), UDPBD_SERVER_PORT);
+    pkt.info.hdr.cmd     = UDPBD_CMD_INFO;
+    pkt.info.hdr.cmdid   = g_cmdid;
+    pkt.info.hdr.cmdpkt  = 0;
+    pkt.info.version     = UDPBD_VERSION;
+    pkt.info.features    = UDPBD_CLIENT_FEATURES;
+    pkt.info.sector_size = UDPBD_SECTOR_SIZE;
+    udp_packet_send(udpbd_socket, (udp_packet_t *)&pkt, sizeof(struct SUDPBDv2_InfoRequest));
+    smap_link_stats.discovery_tries++;
+
+    CancelAlarm(_udpbd_discover_alarm, NULL);
+    USec2SysClock(g_discover_delay * 1000, &clock);
+    SetAlarm(&clock, _udpbd_discover_alarm, NULL);
+
+    g_discover_delay *= 2;
+    if (g_discover_delay > UDPBD_DISCOVER_MAX_DELAY)
+        g_discover_delay = UDPBD_DISCOVER_MAX_DELAY;
+}
+
+// The link just came (back) up, the server is most likely to answer now
+void udpbd_link_up(void)
+{
+    if (bdm_connected != 0)
+        return;
+
+    g_discover_delay = UDPBD_DISCOVER_MIN_DELAY;
+    g_discover_start = smap_get_time_usec();
+    udpbd_discover();
+}
+
 int udpbd_init(void)
 {
     USE_SPD_REGS;
-    udpbd_pkt_t pkt;
     iop_event_t EventFlagData;
 
     //M_DEBUG("%s\n", __func__);
@@ -444,15 +1202,15 @@ int udpbd_init(void)
     g_udpbd.flush        = udpbd_flush;
     g_udpbd.stop         = udpbd_stop;
 
+    udpbd_cache_alloc();
+    DelDrv(UDPBD_DEVNAME);
+    AddDrv(&udpbd_dev);
+
     // Bind to UDP socket
     udpbd_socket = udp_bind(UDPBD_CLIENT_PORT, udpbd_isr, NULL);
 
-    // Broadcast request for block device information
-    udp_packet_init((udp_packet_t *)&pkt, IP_ADDR(255,255,255,255), UDPBD_SERVER_PORT);
-    pkt.bd.cmd    = UDPBD_CMD_INFO;
-    pkt.bd.cmdid  = g_cmdid;
-    pkt.bd.cmdpkt = 0;
-    udp_packet_send(udpbd_socket, (udp_packet_t *)&pkt, sizeof(struct SUDPBDv2_Header));
+    g_discover_start = smap_get_time_usec();
+    udpbd_discover();
 
     return 0;
 }
@@ -15,9 +15,19 @@
 #define UDPBD_CMD_WRITE       0x04 // client -> server
 #define UDPBD_CMD_WRITE_RDMA  0x05 // client -> server
 #define UDPBD_CMD_WRITE_DONE  0x06 // server -> client
+#define UDPBD_CMD_HINT        0x07 // client -> server
+#define UDPBD_CMD_GEOMETRY    0x08 // client -> server
+#define UDPBD_CMD_GEOMETRY_ACK 0x09 // server -> client
 
 
-#define UDPBD_MAX_SECTOR_READ  512 // 512 sectors of 512 bytes = 256KiB
+#define UDPBD_MAX_SECTOR_READ  512 // 512 sectors of 512 bytes = 256KiB, limit for servers without UDPBD_FEATURE_LARGE_XFER
+
+#define UDPBD_VERSION          1    // Version of the INFO negotiation, 0 for servers that don't negotiate
+
+#define UDPBD_FEATURE_HINT         (1 << 0) // Server accepts UDPBD_CMD_HINT
+#define UDPBD_FEATURE_SECTOR_SIZE  (1 << 1) // Server can present the sector size asked for by the client
+#define UDPBD_FEATURE_LARGE_XFER   (1 << 2) // max_sectors applies, and write RDMA packets may carry up to 1408 bytes
+#define UDPBD_FEATURE_GEOMETRY     (1 << 3) // Server accepts UDPBD_CMD_GEOMETRY
 
 
 /*
@@ -43,15 +53,25 @@ struct SUDPBDv2_Header { // 2 bytes - Must be a "(multiple of 4) + 2" for RDMA o
  * Sequence of packets:
  * - client: InfoRequest
  * - server: InfoReply
+ *
+ * Everything after the header is optional. Servers that don't negotiate
+ * ignore the request fields and send a reply without the version fields,
+ * which the client detects from the UDP length.
  */
 struct SUDPBDv2_InfoRequest {
 	struct SUDPBDv2_Header hdr;
+	uint16_t version;     // UDPBD_VERSION of the client
+	uint32_t features;    // UDPBD_FEATURE_* supported by the client
+	uint32_t sector_size; // Preferred logical sector size
 } __attribute__((__packed__));
 
 struct SUDPBDv2_InfoReply {
 	struct SUDPBDv2_Header hdr;
 	uint32_t sector_size;
 	uint32_t sector_count;
+	uint16_t version;     // UDPBD_VERSION of the server
+	uint16_t max_sectors; // Maximum sector_count of a single read or write request
+	uint32_t features;    // UDPBD_FEATURE_* supported by both client and server
 } __attribute__((__packed__));
 
 /*
@@ -75,6 +95,43 @@ struct SUDPBDv2_WriteDone {
 	int32_t result;
 } __attribute__((__packed__));
 
+/*
+ * Access hint, sequence of packets:
+ * - client: Hint
+ *
+ * Tells the server which sectors the client expects to read next, so it can
+ * pull them from its backing storage into memory before the read request
+ * arrives. There is no reply, and servers that don't know the command are
+ * expected to ignore it.
+ */
+#define UDPBD_HINT_SEQUENTIAL  0 // Sectors will be read in order
+#define UDPBD_HINT_RANDOM      1 // No read-ahead is useful, drop any prefetched data
+#define UDPBD_HINT_WILLNEED    2 // Sectors will be read soon, order unknown
+
+struct SUDPBDv2_Hint {
+	struct SUDPBDv2_Header hdr;
+	uint32_t sector_nr;
+	uint32_t sector_count;
+	uint16_t pattern;
+} __attribute__((__packed__));
+
+/*
+ * RDMA geometry, sequence of packets:
+ * - client: Geometry
+ * - server: Geometry (cmd = UDPBD_CMD_GEOMETRY_ACK)
+ *
+ * Sets the block size and blocks per packet of all following READ_RDMA
+ * packets. The best geometry depends on the SPEED revision and the network,
+ * the client finds it by timing a few reads with each candidate. The reply
+ * carries the geometry the server uses from now on, which is the previous
+ * one if the request was invalid.
+ */
+struct SUDPBDv2_Geometry {
+	struct SUDPBDv2_Header hdr;
+	uint16_t block_shift; // Block size is 1U << (block_shift + 2)
+	uint16_t block_count; // Maximum blocks per packet, 0 = as many as fit
+} __attribute__((__packed__));
+
 /*
  * Remote DMA (RDMA) packet
  * Used for transfering large blocks of data.
@@ -112,6 +169,10 @@ struct SUDPBDv2_RDMA {
 
 
 int udpbd_init(void);
+void udpbd_set_cache_size(unsigned int kib);
+void udpbd_set_discover_timeout(unsigned int ms);
+void udpbd_discover(void);
+void udpbd_link_up(void);
 
 
 #endif
@@ -1,17 +1,49 @@
+#include <thbase.h>
+#include <thevent.h>
 #include <thsemap.h>
-#include <ioman.h>
+#include <sysclib.h>
+#include <iomanX.h>
+#include "main.h"
 #include "ministack.h"
+#include "xfer.h"
+#include "udptty.h"
 
 
+#define UDPTTY_PORT        18194
+#define UDPTTY_BUF_SIZE    (UDP_MAX_PAYLOAD - 2) // Minus the 2 header padding bytes
+#define UDPTTY_FLUSH_DELAY 20000 // Buffered output is sent at most 20ms after it was written
+
 static int tty_sema   = -1;
 static char ttyname[] = "tty";
 static udp_packet_t pkt;
+static udp_socket_t tty_socket = {0, NULL, NULL, 0}; // Dummy socket, we do not want anyone to answer
+static char tty_buf[UDPTTY_BUF_SIZE];
+static unsigned int tty_buf_len = 0;
+static unsigned int tty_timer_armed = 0;
+static iop_sys_clock_t tty_flush_clock;
 
 
 static int dummy_m5() { return -5; }
 static int dummy_0()  { return 0; }
 static int dummy_1()  { return 1; }
 
+static unsigned int ttyFlushTimerCB(void *arg)
+{
+    iSetEventFlag(SmapDriverData.Dev9IntrEventFlag, SMAP_EVENT_TTY_FLUSH);
+    return 0;
+}
+
+// Must be called with tty_sema held
+static void ttyFlushLocked(void)
+{
+    if (tty_buf_len == 0)
+        return;
+
+    if (udp_packet_send_ll(&tty_socket, &pkt, 2, tty_buf, tty_buf_len) < 0)
+        smap_tx_stats.tty_dropped += tty_buf_len;
+    tty_buf_len = 0;
+}
+
 static int ttyInit(iop_device_t *driver)
 {
     iop_sema_t sema_info;
@@ -22,25 +54,61 @@ static int ttyInit(iop_device_t *driver)
         return -1;
 
     // Broadcast packet to UDPTTY port
-    udp_packet_init(&pkt, IP_ADDR(255,255,255,255), 18194);
+    udp_packet_init(&pkt, IP_ADDR(255,255,255,255), UDPTTY_PORT);
 
     // We send the header and text separately
-    // This saves IOP RAM (~1K), and also saves a memcpy
+    // This saves a memcpy of the whole packet
     // But the header needs to be a mutiple of 4.
     // So the first 2 characters we send are the header padding bytes
     // Set to two space characters
     pkt.align = 0x2020; // Two spaces
 
+    USec2SysClock(UDPTTY_FLUSH_DELAY, &tty_flush_clock);
+
     return 1;
 }
 
 static int ttyWrite(iop_file_t *file, void *buf, int size)
 {
-    // Dummy socket, we do not want anyone to answer
-    udp_socket_t socket = {0,NULL,NULL};
+    const char *data = buf;
+    int left = size;
+    int newline = 0;
+
+    // The SMAP thread must never block here: a writer holding the semaphore may be waiting on it to transmit
+    if ((tty_socket.flags & UDP_SOCKET_NONBLOCK) || GetThreadId() == SmapDriverData.IntrHandlerThreadID) {
+        if (PollSema(tty_sema) < 0) {
+            smap_tx_stats.tty_dropped += size;
+            return size;
+        }
+    } else
+        WaitSema(tty_sema);
+
+    // Pack output into as few packets as possible, send when a line is complete or the buffer is full
+    while (left > 0) {
+        unsigned int n = UDPTTY_BUF_SIZE - tty_buf_len;
+        if (n > left)
+            n = left;
+
+        memcpy(&tty_buf[tty_buf_len], data, n);
+        tty_buf_len += n;
+        data += n;
+        left -= n;
+
+        if (tty_buf_len == UDPTTY_BUF_SIZE)
+            ttyFlushLocked();
+    }
+
+    if (tty_buf_len > 0 && tty_buf[tty_buf_len - 1] == '\n')
+        newline = 1;
+
+    if (newline)
+        ttyFlushLocked();
+    else if (tty_buf_len > 0 && !tty_timer_armed) {
+        // Send partial lines after a short delay
+        tty_timer_armed = 1;
+        SetAlarm(&tty_flush_clock, ttyFlushTimerCB, NULL);
+    }
 
-    WaitSema(tty_sema);
-    udp_packet_send_ll(&socket, &pkt, 2, buf, size);
     SignalSema(tty_sema);
 
     return size;
@@ -72,6 +140,29 @@ iop_device_t tty_driver = {
     "TTY via Udp",
     &tty_functarray};
 
+// Called from the SMAP thread when the flush timer expires
+void udptty_flush(void)
+{
+    // A writer holds the buffer right now, try again a little later
+    if (PollSema(tty_sema) < 0) {
+        SetAlarm(&tty_flush_clock, ttyFlushTimerCB, NULL);
+        return;
+    }
+
+    tty_timer_armed = 0;
+    ttyFlushLocked();
+
+    SignalSema(tty_sema);
+}
+
+void udptty_set_nonblocking(int enable)
+{
+    if (enable)
+        tty_socket.flags |= UDP_SOCKET_NONBLOCK;
+    else
+        tty_socket.flags &= ~UDP_SOCKET_NONBLOCK;
+}
+
 int udptty_init()
 {
     close(0);
@@ -2,5 +2,7 @@
 #define TTY_H
 
 int udptty_init();
+void udptty_flush(void);
+void udptty_set_nonblocking(int enable);
 
 #endif
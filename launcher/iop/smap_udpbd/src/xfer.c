@@ -1,5 +1,6 @@
 #include <dmacman.h>
 #include <dev9.h>
+#include <thbase.h>
 #include <thevent.h>
 #include <thsemap.h>
 #include <smapregs.h>
@@ -7,9 +8,16 @@
 #include "xfer.h"
 #include "ministack.h"
 
-extern struct SmapDriverData SmapDriverData;
+// HandleTxReqs attempts on the SMAP thread before a frame is dropped, about 1us each
+#define TX_SPIN_MAX     2000
+// Time to wait for TXEND before checking the Tx ring again, in case the interrupt got lost
+#define TX_WAIT_TIMEOUT 2000
+
 static int tx_sema = -1;
 static int tx_done_ev = -1;
+static volatile int tx_waiting = 0;
+struct smap_rx_stats smap_rx_stats;
+struct smap_tx_stats smap_tx_stats;
 
 
 static void Dev9PreDmaCbHandler(int bcr, int dir)
@@ -127,10 +135,12 @@ int HandleRxIntr(struct SmapDriverData *SmapDrivPrivData)
             length = PktBdPtr->length;
             LengthRounded = (length + 3) & ~3;
             pointer = PktBdPtr->pointer;
+            smap_rx_stats.frames++;
 
             if (ctrl_stat & (SMAP_BD_RX_INRANGE | SMAP_BD_RX_OUTRANGE | SMAP_BD_RX_FRMTOOLONG | SMAP_BD_RX_BADFCS | SMAP_BD_RX_ALIGNERR | SMAP_BD_RX_SHORTEVNT | SMAP_BD_RX_RUNTFRM | SMAP_BD_RX_OVERRUN)) {
                 // Original did this whenever a frame is dropped.
                 SMAP_REG16(SMAP_R_RXFIFO_RD_PTR) = pointer + LengthRounded;
+                smap_rx_stats.drop_error++;
             } else {
                 if (handle_rx_eth(pointer) < 0) {
                     // Original did this whenever a frame is dropped.
@@ -144,6 +154,7 @@ int HandleRxIntr(struct SmapDriverData *SmapDrivPrivData)
             // PktBdPtr->length=0;
             // PktBdPtr->pointer=0;
             SmapDrivPrivData->RxBDIndex++;
+            NumPacketsReceived++;
         } else
             break;
     }
@@ -192,26 +203,104 @@ static int HandleTxReqs(struct SmapDriverData *SmapDrivPrivData, void *header, u
     SmapDrivPrivData->TxBDIndex++;
     SmapDrivPrivData->NumPacketsInTx++;
     SmapDrivPrivData->TxBufferSpaceAvailable -= SizeRounded;
+    smap_tx_stats.frames++;
+    smap_tx_stats.bytes += headersize + datasize;
 
     SMAP_EMAC3_SET32(SMAP_R_EMAC3_TxMODE0, SMAP_E3_TX_GNP_0);
 
     return 1;
 }
 
+void HandleTxIntr(struct SmapDriverData *SmapDrivPrivData)
+{
+    // Wake up the sender waiting for room in the Tx ring, it reclaims the descriptors itself
+    if (tx_waiting)
+        SetEventFlag(tx_done_ev, 1);
+}
+
+static unsigned int TxWaitTimeoutCB(void *arg)
+{
+    iSetEventFlag(tx_done_ev, 2);
+    return 0;
+}
+
 int smap_transmit(void *header, uint16_t headersize, const void *data, uint16_t datasize)
 {
+    volatile u8 *smap_regbase = SmapDriverData.smap_regbase;
+    iop_sys_clock_t clock;
+    u32 EFBits;
+    int retries;
+
+    if (GetThreadId() == SmapDriverData.IntrHandlerThreadID) {
+        // The SMAP thread handles TXEND itself, so it must never wait for it.
+        // A sender blocked on a full ring holds the semaphore, drop the frame in that case.
+        if (PollSema(tx_sema) < 0) {
+            smap_tx_stats.drop_busy++;
+            return -1;
+        }
+
+        // The ring drains without our help, HandleTxReqs reclaims what has been sent.
+        // Give up if it does not, a stuck transmitter must not hang the SMAP thread.
+        for (retries = 0; HandleTxReqs(&SmapDriverData, header, headersize, data, datasize) < 0; retries++) {
+            if (retries >= TX_SPIN_MAX) {
+                smap_tx_stats.drop_full++;
+                SignalSema(tx_sema);
+                return -1;
+            }
+        }
+
+        SignalSema(tx_sema);
+        return 0;
+    }
+
     WaitSema(tx_sema);
 
     // Add packet to queue (if there's room)
     while (HandleTxReqs(&SmapDriverData, header, headersize, data, datasize) < 0) {
-        // Wait for about 1KiB (at a speed of 100Mbps)
-        // FIXME! We want a blocking write, this works but it's not ideal.
-        // - can the interrupt thread fetch the data?
-        // - use a mutex/semaphore?
-        DelayThread(100);
+        // Arm TXEND and retry once, a frame that completed in between has not latched the interrupt
+        ClearEventFlag(tx_done_ev, ~3);
+        tx_waiting = 1;
+        SMAP_REG16(SMAP_R_INTR_CLR) = SMAP_INTR_TXEND;
+        if (HandleTxReqs(&SmapDriverData, header, headersize, data, datasize) >= 0) {
+            tx_waiting = 0;
+            break;
+        }
+        smap_tx_stats.ring_full++;
+        dev9IntrEnable(SMAP_INTR_TXEND);
+
+        // Check the ring again after a while, even without TXEND
+        USec2SysClock(TX_WAIT_TIMEOUT, &clock);
+        SetAlarm(&clock, TxWaitTimeoutCB, NULL);
+        WaitEventFlag(tx_done_ev, 2 | 1, WEF_OR | WEF_CLEAR, &EFBits);
+        CancelAlarm(TxWaitTimeoutCB, NULL);
+        tx_waiting = 0;
+
+        if (!(EFBits & 1))
+            smap_tx_stats.wait_timeouts++;
+    }
+
+    SignalSema(tx_sema);
+
+    return 0;
+}
+
+int smap_transmit_nb(void *header, uint16_t headersize, const void *data, uint16_t datasize)
+{
+    int result;
+
+    if (PollSema(tx_sema) < 0) {
+        smap_tx_stats.drop_busy++;
+        return -1;
     }
 
+    result = HandleTxReqs(&SmapDriverData, header, headersize, data, datasize);
+
     SignalSema(tx_sema);
 
+    if (result < 0) {
+        smap_tx_stats.drop_busy++;
+        return -1;
+    }
+
     return 0;
 }
@@ -25,14 +25,4 @@ typedef enum xparam_types {
 } xparam_types_t;
 #define XPARAM_PARAMS_AMOUNT (PARAM_CACHE_FLASH_CHANNELS + 1)
 
-typedef struct xparam {
-  char name[12];
-  uint32_t param;
-  uint32_t value;
-} xparam_t;
-
-extern const xparam_t XPARAMS[];
-
-#define GET_XPARAM_DB_SIZE() (sizeof(*XPARAMS) / sizeof(XPARAMS[0]))
-
 #endif
@@ -1,888 +0,0 @@
-#include "xparam.h"
-
-/** @file Merged XPARAM database
- * @brief this file merges ROMVER 2.50 Database with entries for all the games passing custom XPARAM via the `PARAM2` entry on SYSTEM.CNF
- */
-
-const xparam_t XPARAMS[] = {
-    // Prince of Persia - Jikan no Suna (Japan) (Taikenban)
-    {"PAPX_905.17", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // UNKNOWN TITLE
-    {"SCAJ_200.04", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // UNKNOWN TITLE
-    {"SCAJ_200.24", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Tekken 5 (Japan, Asia)
-    {"SCAJ_201.25", PARAM_CPU_DELAY, 0x780},
-
-    // Tekken 5 (Japan, Asia)
-    {"SCAJ_201.25", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Tekken 5 (Asia)
-    {"SCAJ_201.26", PARAM_CPU_DELAY, 0x780},
-
-    // Tekken 5 (Asia)
-    {"SCAJ_201.26", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Ridge Racer V (Europe) (En,Fr,De,Es,It)
-    {"SCES_500.00", PARAM_CPU_DELAY, 0xbb8},
-
-    // Tekken 5 (Europe, Australia) (En,Fr,De,Es,It)
-    {"SCES_532.02", PARAM_CPU_DELAY, 0x780},
-
-    // Tekken 5 (Europe, Australia) (En,Fr,De,Es,It)
-    {"SCES_532.02", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Tekken 5 (Korea)
-    {"SCKA_200.49", PARAM_CPU_DELAY, 0x780},
-
-    // Tekken 5 (Korea)
-    {"SCKA_200.49", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Bravo Music (Japan)
-    {"SCPS_110.13", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Dark Chronicle (Japan) (v1.10)
-    {"SCPS_150.33", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // UNKNOWN TITLE
-    {"SCPS_150.39", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // UNKNOWN TITLE
-    {"SCPS_550.29", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // UNKNOWN TITLE
-    {"SCPS_550.42", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // UNKNOWN TITLE
-    {"SCPS_550.48", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Getaway, The (USA) (En,Fr,De,Es,It)
-    {"SCUS_971.33", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // PaRappa the Rapper 2 (USA) (En,Ja)
-    {"SCUS_971.67", PARAM_CACHE_FLASH_CHANNELS, 0x0},
-
-    // PaRappa the Rapper 2 (USA) (En,Ja)
-    {"SCUS_971.67", PARAM_CPU_DELAY, 0xe10},
-
-    // Syphon Filter - The Omega Strain (USA)
-    {"SCUS_972.64", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // SOCOM II - U.S. Navy SEALs (USA)
-    {"SCUS_972.75", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Hot Shots Golf Fore! (USA)
-    {"SCUS_974.01", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Killzone (USA)
-    {"SCUS_974.02", PARAM_CPU_DELAY, 0x780},
-
-    // Killzone (USA)
-    {"SCUS_974.02", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // SSX (Europe) (En,Fr,De)
-    {"SLES_500.30", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Orphen - Scion of Sorcery (Europe)
-    {"SLES_500.62", PARAM_CPU_DELAY, 0xbb8},
-
-    // Orphen - Scion of Sorcery (Europe)
-    {"SLES_500.62", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Driving Emotion Type-S (Europe) (En,Fr,De,Es,It)
-    {"SLES_500.73", PARAM_CPU_DELAY, 0xa28},
-
-    // Driving Emotion Type-S (Europe) (En,Fr,De,Es,It)
-    {"SLES_500.73", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Tony Hawk's Pro Skater 3 (Europe)
-    {"SLES_504.35", PARAM_CACHE_FLASH_CHANNELS, 0x0},
-
-    // LEGO Racers 2 (Europe) (En,Fr,De,Es,It,Nl,Sv,Da)
-    {"SLES_504.43", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Iron Aces 2 - Birds of Prey (Europe)
-    {"SLES_506.86", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Fighting Fury (Europe)
-    {"SLES_510.56", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Hard Hitter 2 (Europe) (En,Fr,De)
-    {"SLES_510.57", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Nickelodeon Jimmy Neutron - Boy Genius (Australia)
-    {"SLES_512.98", PARAM_CPU_DELAY, 0x1db0},
-
-    // Nickelodeon Jimmy Neutron - Boy Genius (Australia)
-    {"SLES_512.98", PARAM_DMAC_CH10_INT_DELAY, 0x3e8},
-
-    // Nickelodeon Jimmy Neutron - Boy Genius (Australia)
-    {"SLES_512.98", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Drome Racers (Europe) (En,Fr,De,Es,It,Nl,Sv,Da)
-    {"SLES_513.03", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Big Mutha Truckers (Europe) (En,Fr,De,Es,It)
-    {"SLES_513.55", PARAM_CPU_DELAY, 0xbb8},
-
-    // Big Mutha Truckers (Europe) (En,Fr,De,Es,It)
-    {"SLES_513.55", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Fatman & Slim (Europe) (Proto)
-    {"SLES_514.25", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Chaos Legion (Europe) (En,Fr,De,Es,It)
-    {"SLES_515.53", PARAM_CACHE_FLASH_CHANNELS, 0x0},
-
-    // Chaos Legion (Europe) (En,Fr,De,Es,It)
-    {"SLES_515.53", PARAM_CPU_DELAY, 0xfa0},
-
-    // Chaos Legion (Europe) (En,Fr,De,Es,It)
-    {"SLES_515.53", PARAM_DMAC_CH10_INT_DELAY, 0x708},
-
-    // Bad Boys II (Europe)
-    {"SLES_517.72", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Beyond Good & Evil (Europe, Australia) (En,Fr,De,Es,It,Nl)
-    {"SLES_519.17", PARAM_CPU_DELAY, 0x960},
-
-    // Beyond Good & Evil (Europe, Australia) (En,Fr,De,Es,It,Nl)
-    {"SLES_519.17", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Nickelodeon The Adventures of Jimmy Neutron - Boy Genius - Jet Fusion (Europe)
-    {"SLES_519.32", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Disney's The Haunted Mansion (UK)
-    {"SLES_522.14", PARAM_CPU_DELAY, 0xaf0},
-
-    // Disney's The Haunted Mansion (UK)
-    {"SLES_522.14", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Dot Hack Part 1 - Infection (Europe) (En,Fr,De,Es,It)
-    {"SLES_522.37", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Energy Airforce - Aim Strike! (Europe)
-    {"SLES_522.65", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Dot Hack Part 2 - Mutation (Europe) (En,Fr,De,Es,It)
-    {"SLES_524.67", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Dot Hack Part 4 - Quarantine (Europe) (En,Fr,De,Es,It)
-    {"SLES_524.68", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Dot Hack Part 3 - Outbreak (Europe) (En,Fr,De,Es,It)
-    {"SLES_524.69", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Army Men - Sarge's War (Europe) (En,Fr,De,Es,It)
-    {"SLES_525.87", PARAM_DMAC_CH10_INT_DELAY, 0x5dc},
-
-    // LMA Manager 2005 (Europe)
-    {"SLES_526.93", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // TY the Tasmanian Tiger 2 - Bush Rescue (Europe) (En,Fr,De,Es,It,Sv,Da)
-    {"SLES_527.09", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Get on da Mic (Europe) (En,Fr,It)
-    {"SLES_528.11", PARAM_CPU_DELAY, 0x1388},
-
-    // Gadget & the Gadgetinis (Europe) (En,Fr,De,Es,It,Nl)
-    {"SLES_528.45", PARAM_CPU_DELAY, 0x2ee0},
-
-    // Gadget & the Gadgetinis (Europe) (En,Fr,De,Es,It,Nl)
-    {"SLES_528.45", PARAM_DMAC_CH10_INT_DELAY, 0x2ee0},
-
-    // Gadget & the Gadgetinis (Europe) (En,Fr,De,Es,It,Nl)
-    {"SLES_528.45", PARAM_DMAC_CH10_INT_DELAY_DPC, 0x2bf20},
-
-    // Gadget & the Gadgetinis (Europe) (En,Fr,De,Es,It,Nl)
-    {"SLES_528.45", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // King Arthur (Europe) (En,Fr,De,Es,It)
-    {"SLES_528.61", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Chaos Legion (Korea)
-    {"SLKA_250.26", PARAM_CACHE_FLASH_CHANNELS, 0x0},
-
-    // Chaos Legion (Korea)
-    {"SLKA_250.26", PARAM_CPU_DELAY, 0xfa0},
-
-    // Chaos Legion (Korea)
-    {"SLKA_250.26", PARAM_DMAC_CH10_INT_DELAY, 0x708},
-
-    // UNKNOWN TITLE
-    {"SLKA_250.63", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Dot Hack Vol. 1 - Infection (Korea)
-    {"SLKA_250.80", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Sudogo Battle 01 (Korea)
-    {"SLKA_250.84", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Dot Hack Vol. 2 - Mutation (Korea)
-    {"SLKA_251.38", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Dot Hack Vol. 3 - Outbreak (Korea)
-    {"SLKA_251.45", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // UNKNOWN TITLE
-    {"SLKA_251.46", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // UNKNOWN TITLE
-    {"SLKA_251.74", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // UNKNOWN TITLE
-    {"SLKA_252.18", PARAM_CPU_DELAY, 0xc80},
-
-    // UNKNOWN TITLE
-    {"SLKA_252.18", PARAM_DMAC_CH10_INT_DELAY, 0x190},
-
-    // UNKNOWN TITLE
-    {"SLKA_252.18", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // UNKNOWN TITLE
-    {"SLKA_252.34", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // UNKNOWN TITLE
-    {"SLKA_252.57", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Kaidou Battle - Nikko, Haruna, Rokko, Hakone (Japan) (Taikenban)
-    {"SLPM_601.95", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Initial D - Special Stage (Japan) (Taikenban)
-    {"SLPM_602.04", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Initial D - Special Stage (Japan) (Tokubetsu Taikenban)
-    {"SLPM_602.05", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // UNKNOWN TITLE
-    {"SLPM_602.22", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // UNKNOWN TITLE
-    {"SLPM_602.23", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Dengeki PS2 PlayStation D60 (Japan)
-    {"SLPM_610.48", PARAM_CPU_DELAY, 0x960},
-
-    // Dengeki PS2 PlayStation D60 (Japan)
-    {"SLPM_610.48", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Fuuun Bakumatsuden (Japan) (Taikenban)
-    {"SLPM_610.96", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Maestromusic II, The (Japan) (Doukonban)
-    {"SLPM_620.77", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Maestromusic II, The (Japan)
-    {"SLPM_620.78", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Se-Pa 2001 (Japan)
-    {"SLPM_620.79", PARAM_CPU_DELAY, 0x640},
-
-    // Se-Pa 2001 (Japan)
-    {"SLPM_620.79", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Jikkyou Powerful Pro Yakyuu 8 - Ketteiban (Japan)
-    {"SLPM_621.19", PARAM_CPU_DELAY, 0x622},
-
-    // Gauntlet - Dark Legacy (Japan)
-    {"SLPM_621.25", PARAM_CPU_DELAY, 0xfa0},
-
-    // Gauntlet - Dark Legacy (Japan)
-    {"SLPM_621.25", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Baseball 2002, The - Battle Ball Park Sengen (Japan)
-    {"SLPM_621.55", PARAM_CPU_DELAY, 0x668},
-
-    // LEGO Racers 2 (Japan)
-    {"SLPM_622.04", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Virtua Cop Re-Birth (Japan)
-    {"SLPM_622.05", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Simple 2000 Series Vol. 10 - The Table Game Sekai-hen - Chess, Backgammon, Diamond, Gunjin Shougi, etc. (Japan)
-    {"SLPM_622.18", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Simple 2000 Series Vol. 17 - The Suiri - Arata naru 20 no Jikenbo (Japan)
-    {"SLPM_622.52", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Kaerazu no Mori (Japan)
-    {"SLPM_622.54", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Magical Pachinko Cotton - Pachinko Jikki Simulation (Japan)
-    {"SLPM_622.93", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // AI Shougi 2003 (Japan)
-    {"SLPM_623.23", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // AI Igo 2003 (Japan)
-    {"SLPM_623.29", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // AI Mahjong 2003 (Japan)
-    {"SLPM_623.30", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Ripuru no Tamago - Apprentice Magician (Japan)
-    {"SLPM_623.40", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Simple 2000 Series Vol. 35 - The Helicopter (Japan)
-    {"SLPM_623.73", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Bakusou Convoy Densetsu - Otoko Hanamichi America Roman (Japan)
-    {"SLPM_623.78", PARAM_CPU_DELAY, 0xbb8},
-
-    // Bakusou Convoy Densetsu - Otoko Hanamichi America Roman (Japan)
-    {"SLPM_623.78", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Harry Potter - Quidditch World Cup (Japan)
-    {"SLPM_624.08", PARAM_DMAC_CH10_INT_DELAY, 0x600},
-
-    // Victory Wings - Zero Pilot Series (Japan)
-    {"SLPM_625.11", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Simple 2000 Series Vol. 65 - The Kyonshii Panic (Japan)
-    {"SLPM_625.43", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Onimusha (Japan)
-    {"SLPM_650.10", PARAM_CPU_DELAY, 0x190},
-
-    // Onimusha (Japan)
-    {"SLPM_650.10", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // GuitarFreaks 3rd Mix & DrumMania 2nd Mix (Japan)
-    {"SLPM_650.11", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Para Para Paradise (Japan)
-    {"SLPM_650.20", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Super Galdelic Hour (Japan)
-    {"SLPM_650.21", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Kessen (Japan) (Super Value Set)
-    {"SLPM_650.30", PARAM_CPU_DELAY, 0xdac},
-
-    // Kessen (Japan) (Super Value Set)
-    {"SLPM_650.30", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Gitadora! GuitarFreaks 4th Mix & DrumMania 3rd Mix (Japan) (v1.01)
-    {"SLPM_650.52", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // A Visual Mix - Ayumi Hamasaki Dome Tour 2001 A (Japan) (Disc 1)
-    {"SLPM_650.86", PARAM_CPU_DELAY, 0xb60},
-
-    // A Visual Mix - Ayumi Hamasaki Dome Tour 2001 A (Japan) (Disc 1)
-    {"SLPM_650.86", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // A Visual Mix - Ayumi Hamasaki Dome Tour 2001 A (Japan) (Disc 2)
-    {"SLPM_650.87", PARAM_CPU_DELAY, 0xb60},
-
-    // A Visual Mix - Ayumi Hamasaki Dome Tour 2001 A (Japan) (Disc 2)
-    {"SLPM_650.87", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Switch (Japan)
-    {"SLPM_651.21", PARAM_CPU_DELAY, 0x9c4},
-
-    // Switch (Japan)
-    {"SLPM_651.21", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Judie no Atelier - Gramnad no Renkinjutsushi (Japan) (v1.03)
-    {"SLPM_651.31", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Culdcept II Expansion (Japan) (v1.01)
-    {"SLPM_651.79", PARAM_CPU_DELAY, 0xbb8},
-
-    // Culdcept II Expansion (Japan) (v1.01)
-    {"SLPM_651.79", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Star Ocean - Till the End of Time (Japan, Asia) (v1.10)
-    {"SLPM_652.09", PARAM_CPU_DELAY, 0xaf0},
-
-    // Star Ocean - Till the End of Time (Japan, Asia) (v1.10)
-    {"SLPM_652.09", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Bakusou Dekotora Densetsu - Otoko Hanamichi Yume Roman (Japan)
-    {"SLPM_652.34", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Pro Yakyuu Team o Tsukurou! 2 (Japan)
-    {"SLPM_652.40", PARAM_CPU_DELAY, 0x67c},
-
-    // Kaidou Battle - Nikko, Haruna, Rokko, Hakone (Japan)
-    {"SLPM_652.46", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Chaos Legion (Japan) (En,Ja)
-    {"SLPM_652.49", PARAM_CACHE_FLASH_CHANNELS, 0x0},
-
-    // Chaos Legion (Japan) (En,Ja)
-    {"SLPM_652.49", PARAM_CPU_DELAY, 0xfa0},
-
-    // Chaos Legion (Japan) (En,Ja)
-    {"SLPM_652.49", PARAM_DMAC_CH10_INT_DELAY, 0x708},
-
-    // Initial D - Special Stage (Japan, Asia) (v1.01)
-    {"SLPM_652.68", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Saishuu Heiki Kanojo (Japan)
-    {"SLPM_652.75", PARAM_DMAC_CH10_INT_DELAY, 0x600},
-
-    // Shutokou Battle 01 (Japan)
-    {"SLPM_653.08", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Tennis no Oujisama - Sweat & Tears 2 (Japan)
-    {"SLPM_653.70", PARAM_CPU_DELAY, 0xa28},
-
-    // Tennis no Oujisama - Sweat & Tears 2 (Japan)
-    {"SLPM_653.70", PARAM_DMAC_CH10_INT_DELAY, 0x12c},
-
-    // Tennis no Oujisama - Sweat & Tears 2 (Japan)
-    {"SLPM_653.70", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Energy Airforce AimStrike! (Japan)
-    {"SLPM_653.74", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // UNKNOWN TITLE
-    {"SLPM_654.24", PARAM_CACHE_FLASH_CHANNELS, 0x0},
-
-    // UNKNOWN TITLE
-    {"SLPM_654.24", PARAM_DMAC_CH10_INT_DELAY, 0x8ca0},
-
-    // Moekan - Moe Musume Shima e Youkoso (Japan)
-    {"SLPM_654.25", PARAM_CACHE_FLASH_CHANNELS, 0x0},
-
-    // Moekan - Moe Musume Shima e Youkoso (Japan)
-    {"SLPM_654.25", PARAM_DMAC_CH10_INT_DELAY, 0x8ca0},
-
-    // Star Ocean - Till the End of Time - Director's Cut (Japan) (Disc 1)
-    {"SLPM_654.38", PARAM_CPU_DELAY, 0xaf0},
-
-    // Star Ocean - Till the End of Time - Director's Cut (Japan) (Disc 1)
-    {"SLPM_654.38", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // SSX 3 (Japan)
-    {"SLPM_654.49", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Bujingai (Japan, Asia)
-    {"SLPM_654.59", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Kaidou Battle 2 - Chain Reaction (Japan)
-    {"SLPM_655.14", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // SuperLite 2000 Vol. 23 - Never 7 - The End of Infinity (Japan)
-    {"SLPM_656.89", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Dragon Quest & Final Fantasy in Itadaki Street Special (Japan)
-    {"SLPM_657.97", PARAM_CPU_DELAY, 0x60e},
-
-    // Fuuun Bakumatsuden (Japan)
-    {"SLPM_658.13", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Shin Bakusou Dekotora Densetsu - Tenka Touitsu Choujou Kessen (Japan)
-    {"SLPM_658.16", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Metal Saga - Sajin no Kusari (Japan)
-    {"SLPM_658.68", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Duel Masters - Birth of Super Dragon (Japan)
-    {"SLPM_658.82", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Kaidou - Touge no Densetsu (Japan)
-    {"SLPM_660.22", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Kaidou - Touge no Densetsu (Japan)
-    {"SLPM_660.22", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Taito Memories - Joukan (Japan)
-    {"SLPM_660.57", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Taito Memories - Gekan (Japan)
-    {"SLPM_660.92", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Onimusha (Japan)
-    {"SLPM_665.01", PARAM_CPU_DELAY, 0x190},
-
-    // Onimusha (Japan)
-    {"SLPM_665.01", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // UNKNOWN TITLE
-    {"SLPM_675.28", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Initial D - Special Stage (Japan) (Koudansha Kenshouhin)
-    {"SLPM_685.09", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Culdcept II Expansion (Japan) (v3.00)
-    {"SLPM_744.11", PARAM_CPU_DELAY, 0xbb8},
-
-    // Culdcept II Expansion (Japan) (v3.00)
-    {"SLPM_744.11", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Driving Emotion Type-S (Japan)
-    {"SLPS_200.07", PARAM_CPU_DELAY, 0xa28},
-
-    // Driving Emotion Type-S (Japan)
-    {"SLPS_200.07", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Morita Shougi (Japan)
-    {"SLPS_200.08", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Pro Mahjong Kiwame Next (Japan) (v1.00)
-    {"SLPS_200.35", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Magical Sports 2000 Koushien (Japan)
-    {"SLPS_200.36", PARAM_CPU_DELAY, 0xbb8},
-
-    // Magical Sports 2000 Koushien (Japan)
-    {"SLPS_200.36", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Grappler Baki - Baki Saikyou Retsuden (Japan)
-    {"SLPS_200.38", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Kuusen (Japan)
-    {"SLPS_200.46", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Hissatsu Pachinko Station V - Honoo no Bakushougun (Japan)
-    {"SLPS_200.51", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Typing Namidabashi - Ashita no Joe Touda (Japan) (USB Keyboard Doukonban)
-    {"SLPS_200.80", PARAM_CACHE_FLASH_CHANNELS, 0x0},
-
-    // Typing Namidabashi - Ashita no Joe Touda (Japan) (USB Keyboard Doukonban)
-    {"SLPS_200.80", PARAM_CPU_DELAY, 0xfa0},
-
-    // Typing Namidabashi - Ashita no Joe Touda (Japan)
-    {"SLPS_200.81", PARAM_CACHE_FLASH_CHANNELS, 0x0},
-
-    // Typing Namidabashi - Ashita no Joe Touda (Japan)
-    {"SLPS_200.81", PARAM_CPU_DELAY, 0xfa0},
-
-    // Gekisha Boy 2 - Tokudane Taikoku Nippon (Japan)
-    {"SLPS_200.91", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Tetsu One - Densha de Battle! (Japan)
-    {"SLPS_201.00", PARAM_CACHE_FLASH_CHANNELS, 0x0},
-
-    // Tetsu One - Densha de Battle! (Japan)
-    {"SLPS_201.00", PARAM_CPU_DELAY, 0xa28},
-
-    // Hissatsu Pachinko Station V2 - Tensai Bakabon (Japan)
-    {"SLPS_201.12", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // F1 2001 (Japan)
-    {"SLPS_201.20", PARAM_DMAC_CH10_INT_DELAY_DPC, 0x64},
-
-    // Marl de Jigsaw (Japan) (Genteiban)
-    {"SLPS_201.28", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Marl de Jigsaw (Japan)
-    {"SLPS_201.29", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // UNKNOWN TITLE
-    {"SLPS_201.56", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Yamasa Digi World 2 LCD Edition - Time Cross, Qlogos, Trigger Zone (Japan)
-    {"SLPS_201.58", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Eikan wa Kimi ni 2002 - Koushien no Kodou (Japan)
-    {"SLPS_201.84", PARAM_CPU_DELAY, 0x9c4},
-
-    // Eikan wa Kimi ni 2002 - Koushien no Kodou (Japan)
-    {"SLPS_201.84", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Black-Matrix II (Japan)
-    {"SLPS_201.87", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Hissatsu Pachinko Station V3 - Shutsudou! Miniskirt Police (Japan)
-    {"SLPS_201.92", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Yamasa Digi World 3 - Time Park, King Pulsar, Cyber Dragon (Japan)
-    {"SLPS_202.11", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Hissatsu Pachinko Station V4 - Drumtic Mahjong (Japan)
-    {"SLPS_202.13", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Hissatsu Pachinko Station V5 - PinkLady (Japan)
-    {"SLPS_202.29", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Hissatsu Pachinko Station V6 - Yume no Chou Tokkyuu (Japan)
-    {"SLPS_202.33", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Hissatsu Pachinko Station V7 - Tensai Bakabon 2 (Japan)
-    {"SLPS_202.79", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Pro Yakyuu Simulation Dugout '03 - The Turning Point (Japan)
-    {"SLPS_202.96", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Fever 8 - Sankyo Koushiki Pachinko Simulation (Japan)
-    {"SLPS_202.98", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Hissatsu Pachinko Station V8 - Ninja Hattori-kun (Japan)
-    {"SLPS_203.16", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Princess Maker (Japan)
-    {"SLPS_203.61", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Eikan wa Kimi ni 2004 - Koushien no Kodou (Japan)
-    {"SLPS_203.79", PARAM_CPU_DELAY, 0x9c4},
-
-    // Eikan wa Kimi ni 2004 - Koushien no Kodou (Japan)
-    {"SLPS_203.79", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // UNKNOWN TITLE
-    {"SLPS_203.90", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Hissatsu Pachinko Station V9 - Osomatsu-kun (Japan)
-    {"SLPS_204.11", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Hissatsu Pachinko Station V10 - Rerere ni Omakase! (Japan)
-    {"SLPS_204.12", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Sorcerous Stabber Orphen (Japan)
-    {"SLPS_250.08", PARAM_CPU_DELAY, 0xbb8},
-
-    // Sorcerous Stabber Orphen (Japan)
-    {"SLPS_250.08", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Hajime no Ippo - Victorious Boxers (Japan)
-    {"SLPS_250.12", PARAM_CPU_DELAY, 0xbb8},
-
-    // Hajime no Ippo - Victorious Boxers (Japan)
-    {"SLPS_250.12", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Jitsumei Jikkyou Keiba - Dream Classic 2001 Spring (Japan)
-    {"SLPS_250.21", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Cool Boarders - Code Alien (Japan)
-    {"SLPS_250.22", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Jitsumei Jikkyou Keiba - Dream Classic - 2001 Autumn (Japan)
-    {"SLPS_250.68", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // FIFA 2002 - Road to FIFA World Cup (Japan)
-    {"SLPS_250.69", PARAM_CPU_DELAY, 0x596},
-
-    // A Visual Mix - Ayumi Hamasaki Dome Tour 2001 A (Japan) (Disc 1) (Alt)
-    {"SLPS_250.71", PARAM_CPU_DELAY, 0xb60},
-
-    // A Visual Mix - Ayumi Hamasaki Dome Tour 2001 A (Japan) (Disc 1) (Alt)
-    {"SLPS_250.71", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // A Visual Mix - Ayumi Hamasaki Dome Tour 2001 A (Japan) (Disc 2) (Alt)
-    {"SLPS_250.72", PARAM_CPU_DELAY, 0xb60},
-
-    // A Visual Mix - Ayumi Hamasaki Dome Tour 2001 A (Japan) (Disc 2) (Alt)
-    {"SLPS_250.72", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Madden NFL Super Bowl 2002 (Japan)
-    {"SLPS_250.79", PARAM_CACHE_FLASH_CHANNELS, 0x10},
-
-    // Madden NFL Super Bowl 2002 (Japan)
-    {"SLPS_250.79", PARAM_CPU_DELAY, 0xc80},
-
-    // Madden NFL Super Bowl 2002 (Japan)
-    {"SLPS_250.79", PARAM_DMAC_CH10_INT_DELAY, 0x3e8},
-
-    // Dot Hack Kansen Kakudai Vol. 1 (Japan)
-    {"SLPS_251.21", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Jitsumei Jikkyou Keiba - Dream Classic 2002 (Japan)
-    {"SLPS_251.25", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // UNKNOWN TITLE
-    {"SLPS_251.28", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // UNKNOWN TITLE
-    {"SLPS_251.29", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Dot Hack Akusei Hen'i Vol. 2 (Japan)
-    {"SLPS_251.43", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Dot Hack Shinshoku Osen Vol. 3 (Japan)
-    {"SLPS_251.58", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Dot Hack Zettai Houi Vol. 4 (Japan)
-    {"SLPS_252.02", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Ys I & II - Eternal Story (Japan) (Tokubetsu Genteiban)
-    {"SLPS_252.05", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Ys I & II - Eternal Story (Japan)
-    {"SLPS_252.06", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Motion Gravure Series - Megumi (Japan)
-    {"SLPS_252.40", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Motion Gravure Series - Mori Hiroko (Japan)
-    {"SLPS_252.41", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Motion Gravure Series - Kitagawa Tomomi (Japan)
-    {"SLPS_252.42", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Motion Gravure Series - Nemoto Harumi (Japan)
-    {"SLPS_252.43", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Never 7 - The End of Infinity (Japan)
-    {"SLPS_252.56", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Virtual View - R.C.T. Eizou Play (Japan)
-    {"SLPS_252.58", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Virtual View - Nemoto Harumi Eizou Play (Japan)
-    {"SLPS_252.59", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Virtual View - Megumi Eizou Play (Japan)
-    {"SLPS_252.60", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Sidewinder V (Japan) (En,Ja)
-    {"SLPS_252.71", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Zero Pilot - Kokuu no Kiseki (Japan)
-    {"SLPS_253.12", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Exciting Pro Wres 5 (Japan)
-    {"SLPS_253.27", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Hitman - Contracts (Japan)
-    {"SLPS_254.06", PARAM_CPU_DELAY, 0xc80},
-
-    // Hitman - Contracts (Japan)
-    {"SLPS_254.06", PARAM_DMAC_CH10_INT_DELAY, 0x190},
-
-    // Hitman - Contracts (Japan)
-    {"SLPS_254.06", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Azumi (Japan)
-    {"SLPS_254.65", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Tekken 5 (Japan, Asia)
-    {"SLPS_255.10", PARAM_CPU_DELAY, 0x780},
-
-    // Tekken 5 (Japan, Asia)
-    {"SLPS_255.10", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Ridge Racer V (USA)
-    {"SLUS_200.02", PARAM_CPU_DELAY, 0xbb8},
-
-    // Orphen - Scion of Sorcery (USA)
-    {"SLUS_200.11", PARAM_CPU_DELAY, 0xbb8},
-
-    // Orphen - Scion of Sorcery (USA)
-    {"SLUS_200.11", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // LEGO Racers 2 (USA)
-    {"SLUS_200.42", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Driving Emotion Type-S (USA) (En,Fr,De,Es,It)
-    {"SLUS_201.13", PARAM_CPU_DELAY, 0xa28},
-
-    // Driving Emotion Type-S (USA) (En,Fr,De,Es,It)
-    {"SLUS_201.13", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Monster Jam - Maximum Destruction (USA)
-    {"SLUS_201.86", PARAM_CPU_DELAY, 0xc80},
-
-    // Monster Jam - Maximum Destruction (USA)
-    {"SLUS_201.86", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Dot Hack Part 1 - Infection (USA)
-    {"SLUS_202.67", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Nickelodeon SpongeBob SquarePants - Revenge of the Flying Dutchman (USA)
-    {"SLUS_204.25", PARAM_CPU_DELAY, 0x2134},
-
-    // NCAA College Football 2K3 (USA)
-    {"SLUS_204.53", PARAM_CPU_DELAY, 0x618},
-
-    // Nickelodeon Jimmy Neutron - Boy Genius (USA)
-    {"SLUS_205.37", PARAM_CPU_DELAY, 0x1db0},
-
-    // Nickelodeon Jimmy Neutron - Boy Genius (USA)
-    {"SLUS_205.37", PARAM_DMAC_CH10_INT_DELAY, 0x3e8},
-
-    // Nickelodeon Jimmy Neutron - Boy Genius (USA)
-    {"SLUS_205.37", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Dot Hack Part 2 - Mutation (USA)
-    {"SLUS_205.62", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Dot Hack Part 3 - Outbreak (USA)
-    {"SLUS_205.63", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Dot Hack Part 4 - Quarantine (USA)
-    {"SLUS_205.64", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Drome Racers (USA)
-    {"SLUS_205.77", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Big Mutha Truckers (USA)
-    {"SLUS_206.05", PARAM_CPU_DELAY, 0xbb8},
-
-    // Big Mutha Truckers (USA)
-    {"SLUS_206.05", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Barbie Horse Adventures - Wild Horse Rescue (USA)
-    {"SLUS_206.64", PARAM_CPU_DELAY, 0x960},
-
-    // Barbie Horse Adventures - Wild Horse Rescue (USA)
-    {"SLUS_206.64", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Chaos Legion (USA) (En,Ja,Fr,Es)
-    {"SLUS_206.95", PARAM_CACHE_FLASH_CHANNELS, 0x0},
-
-    // Chaos Legion (USA) (En,Ja,Fr,Es)
-    {"SLUS_206.95", PARAM_CPU_DELAY, 0xfa0},
-
-    // Chaos Legion (USA) (En,Ja,Fr,Es)
-    {"SLUS_206.95", PARAM_DMAC_CH10_INT_DELAY, 0x708},
-
-    // Nickelodeon Jimmy Neutron - Boy Genius - Jet Fusion (USA)
-    {"SLUS_206.96", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // NCAA Football 2004 (USA)
-    {"SLUS_207.19", PARAM_CPU_DELAY, 0x618},
-
-    // Beyond Good & Evil (USA) (En,Fr,Es)
-    {"SLUS_207.63", PARAM_CPU_DELAY, 0x960},
-
-    // Beyond Good & Evil (USA) (En,Fr,Es)
-    {"SLUS_207.63", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // ESPN NBA 2K5 (USA)
-    {"SLUS_209.20", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // King Arthur (USA)
-    {"SLUS_210.46", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // TY the Tasmanian Tiger 2 - Bush Rescue (USA)
-    {"SLUS_210.57", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Tekken 5 (USA)
-    {"SLUS_210.59", PARAM_CPU_DELAY, 0x780},
-
-    // Tekken 5 (USA)
-    {"SLUS_210.59", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // NCAA March Madness 2005 (USA)
-    {"SLUS_211.00", PARAM_CPU_DELAY, 0x6e0},
-#ifndef SKIP_GAMES_PASSING_XPARAM_FROM_SYSTEM_CNF
-    // Another Century's Episode 2 (Japan)
-    {"SLPS_256.23", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Critical Velocity (Japan)
-    {"SLPS_255.32", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Hissatsu Pachinko Station V11 (Japan)
-    // Hissatsu Pachinko Station V11 - CR Gyaatoruzu (Japan)
-    {"SLPS_255.56", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Matantei Loki Ragnarok - Mayouga - Ushinawareta Bishou (Japan)
-    // NOTE: this game has same XPARAM values and hash as the game Ibara.
-    // The md5 check for this does match but for Ibara does not. For sure that Ibara is just a user error due to it being leftover from this game.
-    // Both games are from Taito and Ibara came much later.
-    {"SLPM_661.41", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Sega Ages 2500 Series Vol. 23 - Sega Memorial Selection (Japan)
-    {"SLPM_627.09", PARAM_MIPS_DCACHE_ON, 0x0},
-
-    // Shin Bakusou Dekotora Densetsu - Tenka Touitsu Choujou Kessen (Japan) (Spike the Best)
-    {"SLPM_663.87", PARAM_MIPS_DCACHE_ON, 0x0},
-#endif
-};
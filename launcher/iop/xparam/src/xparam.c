@@ -17,7 +17,9 @@ void SetDummyXparamValue(void) {
   XPARAM_PARAM_ADDR = 0xFFFFFFFF;
   XPARAM_VALUE_ADDR = 0;
 }
-void CheckGameID(const char *ID);
+// Applies XPARAM pairs passed as arguments.
+// The launcher looks up the title in its own database and passes the matching pairs as
+// argv[2] and onwards: "param value param value ...", with values in decimal
 int _start(int argc, char **argv) {
   int i1;
   int i2;
@@ -26,9 +28,7 @@ int _start(int argc, char **argv) {
   if (IOP_CPU_TYPE == IOP_TYPE_POWERPC) { // used to be a function. simplify it
     SetDummyXparamValue();
     if (1 < argc) {
-      if (argc < 3) {
-        CheckGameID(argv[1]);
-      } else if (3 < argc) {
+      if (3 < argc) {
         z = argv + 2;
         i1 = 2;
         do {
@@ -45,15 +45,3 @@ int _start(int argc, char **argv) {
   return MODULE_NO_RESIDENT_END; // always NO_RESIDENT_END
 }
 
-// used to return int but retval was never used
-void CheckGameID(const char *ID) {
-  int f = 0; // have we found the entry?
-  for (unsigned int i = 0; i < GET_XPARAM_DB_SIZE(); i++) {
-    if (!strcmp(XPARAMS[i].name, ID)) {
-      f = 1;
-      XPARAM_PARAM_ADDR = XPARAMS[i].param;
-      XPARAM_VALUE_ADDR = XPARAMS[i].value;
-    } else if (f)
-      break; // comparison failed but f is true. so there are no more consecutive entries for the same game
-  }
-}
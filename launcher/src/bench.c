@@ -0,0 +1,313 @@
+#include "common.h"
+#include "handlers.h"
+#include "init.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <malloc.h>
+#include <ps2sdkapi.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <timer.h>
+#include <unistd.h>
+#ifdef APA
+#define NEWLIB_PORT_AWARE
+#include <fileXio_rpc.h>
+#include <hdd-ioctl.h>
+#include <io_common.h>
+#endif
+
+#ifndef BENCH_PATH
+#define BENCH_PATH "mc0:/SYS-CONF/BENCH.CSV"
+#endif
+
+#define BENCH_READY_TIMEOUT 20000000        // Max time to wait for the file to become available in microseconds
+#define BENCH_POLL_INTERVAL 10000           // Interval between checks in microseconds
+#define BENCH_OPEN_COUNT 8                  // Number of open/close cycles to average
+#define BENCH_READ_SIZE (8 * 1024 * 1024)   // Max bytes read per block size
+#define BENCH_MAX_PATHS 16
+#define BENCH_MAX_BDM_DEVICES 10
+#define BENCH_PFS_PARTITION "hdd0:__common" // Partition used for paths without a device
+
+// Block sizes used for sequential reads
+static const int benchBlockSizes[] = {512, 4096, 32768, 262144};
+#define BENCH_BLOCK_COUNT (int)(sizeof(benchBlockSizes) / sizeof(benchBlockSizes[0]))
+
+// Devices tried for paths without a device
+static const char *benchDevices[] = {
+    "mc?:",
+#ifdef MMCE
+    "mmce?:",
+#endif
+#ifdef USB
+    "mass:",
+#endif
+#ifdef ATA
+    "ata:",
+#endif
+#ifdef MX4SIO
+    "mx4sio:",
+#endif
+#ifdef ILINK
+    "ilink:",
+#endif
+#ifdef UDPBD
+    "udpbd:",
+#endif
+#ifdef APA
+    BENCH_PFS_PARTITION,
+#endif
+};
+#define BENCH_DEVICE_COUNT (int)(sizeof(benchDevices) / sizeof(benchDevices[0]))
+
+typedef struct {
+  char path[PATH_MAX];
+  int result;                        // 0 on success or a negative error code
+  uint32_t initTime;                 // initModules() time in microseconds
+  uint32_t readyTime;                // Time until the file could be opened in microseconds
+  uint32_t openTime;                 // Average open/close time in microseconds
+  uint32_t rate[BENCH_BLOCK_COUNT];  // Sequential read throughput in KiB/s
+} BenchResult;
+
+// Returns the time in microseconds
+static uint64_t benchTime() { return GetTimerSystemTime() * 1000000 / kBUSCLK; }
+
+// Waits until the file can be opened, replacing the character at slotIdx with every unit number up to slotCount
+static int benchWaitFile(char *path, int slotIdx, int slotCount, uint32_t *readyTime) {
+  uint64_t start = benchTime();
+  int fd;
+
+  while (1) {
+    for (int i = 0; i < slotCount; i++) {
+      if (slotIdx >= 0)
+        path[slotIdx] = i + '0';
+      if ((fd = open(path, O_RDONLY)) >= 0) {
+        close(fd);
+        *readyTime = benchTime() - start;
+        return 0;
+      }
+    }
+    if ((benchTime() - start) >= BENCH_READY_TIMEOUT)
+      return -ENODEV;
+    usleep(BENCH_POLL_INTERVAL);
+  }
+}
+
+#ifdef APA
+// Waits for the HDD and mounts the partition from the hdd0:<partition>/<path> path
+static int benchMountPFS(char *path, char *filePath) {
+  char partition[PATH_MAX];
+  char *p = strchr(&path[5], '/');
+  uint64_t start = benchTime();
+  int fd;
+
+  if (!p)
+    return -EINVAL;
+
+  strncpy(partition, path, p - path);
+  partition[p - path] = '\0';
+  snprintf(filePath, PATH_MAX, "%s%s", PFS_MOUNTPOINT, p);
+
+  while ((fd = open("hdd0:", O_DIRECTORY | O_RDONLY)) < 0) {
+    if ((benchTime() - start) >= BENCH_READY_TIMEOUT)
+      return -ENODEV;
+    usleep(BENCH_POLL_INTERVAL);
+  }
+  close(fd);
+
+  if (fileXioMount(PFS_MOUNTPOINT, partition, FIO_MT_RDONLY))
+    return -ENODEV;
+  return 0;
+}
+
+static void benchUmountPFS() {
+  fileXioDevctl(PFS_MOUNTPOINT, PDIOC_CLOSEALL, NULL, 0, NULL, 0);
+  fileXioSync(PFS_MOUNTPOINT, FXIO_WAIT);
+  fileXioUmount(PFS_MOUNTPOINT);
+}
+#endif
+
+// Reads the file sequentially and returns the throughput in KiB/s
+static uint32_t benchRead(char *path, uint8_t *buffer, int blockSize) {
+  int fd = open(path, O_RDONLY);
+  if (fd < 0)
+    return 0;
+
+  uint64_t total = 0;
+  uint64_t start = benchTime();
+  int res;
+  while (total < BENCH_READ_SIZE && (res = read(fd, buffer, blockSize)) > 0)
+    total += res;
+  uint64_t elapsed = benchTime() - start;
+
+  close(fd);
+  if (!elapsed)
+    return 0;
+  return (total * 1000000 / 1024) / elapsed;
+}
+
+// Measures a single device
+static void benchPath(BenchResult *r, uint8_t *buffer) {
+  char filePath[PATH_MAX];
+  int slotIdx = -1;
+  int slotCount = 1;
+
+  DeviceType device = guessDeviceType(r->path);
+  if (device == Device_None || device == Device_CDROM) {
+    r->result = -ENODEV;
+    return;
+  }
+
+  uint64_t start = benchTime();
+  if ((r->result = initModules(device)))
+    return;
+  r->initTime = benchTime() - start;
+
+  // Build the path usable with open()
+  switch (device) {
+  case Device_MemoryCard:
+  case Device_MMCE:
+    strcpy(filePath, r->path);
+    slotIdx = (device == Device_MemoryCard) ? 2 : 4;
+    if (filePath[slotIdx] == '?')
+      slotCount = 2;
+    else
+      slotIdx = -1;
+    break;
+#ifdef APA
+  case Device_PFS:
+    start = benchTime();
+    if ((r->result = benchMountPFS(r->path, filePath)))
+      return;
+    break;
+#endif
+  default: {
+    // BDM, use the first mass?: device that has the file
+    char *bdmPath = normalizePath(r->path, device);
+    if (!bdmPath) {
+      r->result = -ENODEV;
+      return;
+    }
+    strcpy(filePath, bdmPath);
+    slotIdx = 4;
+    slotCount = BENCH_MAX_BDM_DEVICES;
+  }
+  }
+
+  if ((r->result = benchWaitFile(filePath, slotIdx, slotCount, &r->readyTime)))
+    goto out;
+#ifdef APA
+  // Include the mount time
+  if (device == Device_PFS)
+    r->readyTime = benchTime() - start;
+#endif
+
+  start = benchTime();
+  for (int i = 0; i < BENCH_OPEN_COUNT; i++) {
+    int fd = open(filePath, O_RDONLY);
+    if (fd < 0) {
+      r->result = fd;
+      goto out;
+    }
+    close(fd);
+  }
+  r->openTime = (benchTime() - start) / BENCH_OPEN_COUNT;
+
+  for (int i = 0; i < BENCH_BLOCK_COUNT; i++)
+    r->rate[i] = benchRead(filePath, buffer, benchBlockSizes[i]);
+
+out:
+#ifdef APA
+  if (device == Device_PFS)
+    benchUmountPFS();
+#endif
+  return;
+}
+
+// Appends the results to the CSV file on the memory card
+static int benchWriteCSV(BenchResult *results, int count) {
+  char line[PATH_MAX + 128];
+  int res;
+
+  if ((res = initModules(Device_MemoryCard)))
+    return res;
+
+  int fd = open(BENCH_PATH, O_WRONLY | O_CREAT);
+  if (fd < 0)
+    return fd;
+
+  // Write the header to new files
+  if (lseek(fd, 0, SEEK_END) == 0) {
+    res = snprintf(line, sizeof(line), "path,result,init_us,ready_us,open_us");
+    for (int i = 0; i < BENCH_BLOCK_COUNT; i++)
+      res += snprintf(&line[res], sizeof(line) - res, ",read%d_kibs", benchBlockSizes[i]);
+    res += snprintf(&line[res], sizeof(line) - res, "\n");
+    write(fd, line, res);
+  }
+
+  for (int i = 0; i < count; i++) {
+    res = snprintf(line, sizeof(line), "%s,%d,%u,%u,%u", results[i].path, results[i].result, results[i].initTime, results[i].readyTime,
+                   results[i].openTime);
+    for (int j = 0; j < BENCH_BLOCK_COUNT; j++)
+      res += snprintf(&line[res], sizeof(line) - res, ",%u", results[i].rate[j]);
+    res += snprintf(&line[res], sizeof(line) - res, "\n");
+    if (write(fd, line, res) != res) {
+      close(fd);
+      return -EIO;
+    }
+  }
+
+  close(fd);
+  return 0;
+}
+
+// Measures module initialization, device ready and open times and read throughput for every path
+int handleBenchmark(int argc, char *argv[]) {
+  BenchResult *results = calloc(BENCH_MAX_PATHS, sizeof(BenchResult));
+  uint8_t *buffer = memalign(64, benchBlockSizes[BENCH_BLOCK_COUNT - 1]);
+  int count = 0;
+
+  int res = -ENOMEM;
+
+  if (!results || !buffer)
+    goto out;
+
+  // Paths starting with '/' are tried on every device, others are used as is
+  for (int i = 0; i < argc; i++) {
+    if (argv[i][0] == '/') {
+      for (int j = 0; j < BENCH_DEVICE_COUNT && count < BENCH_MAX_PATHS; j++)
+        snprintf(results[count++].path, PATH_MAX, "%s%s", benchDevices[j], argv[i]);
+    } else if (count < BENCH_MAX_PATHS)
+      snprintf(results[count++].path, PATH_MAX, "%s", argv[i]);
+  }
+  if (!count) {
+    msg("Usage: -bench </path to file> [<device:/path to file> ...]\n");
+    res = -EINVAL;
+    goto out;
+  }
+
+  for (int i = 0; i < count; i++) {
+    msg("%s: ", results[i].path);
+    benchPath(&results[i], buffer);
+    if (results[i].result) {
+      msg("failed: %d\n", results[i].result);
+      continue;
+    }
+
+    msg("init %ums, ready %ums, open %uus\n", results[i].initTime / 1000, results[i].readyTime / 1000, results[i].openTime);
+    for (int j = 0; j < BENCH_BLOCK_COUNT; j++)
+      msg("  %6d byte reads: %u KiB/s\n", benchBlockSizes[j], results[i].rate[j]);
+  }
+
+  res = benchWriteCSV(results, count);
+  if (res)
+    msg("Failed to write %s: %d\n", BENCH_PATH, res);
+  else
+    msg("Results saved to %s\n", BENCH_PATH);
+
+out:
+  free(buffer);
+  free(results);
+  return res;
+}
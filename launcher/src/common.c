@@ -1,5 +1,6 @@
 #include "handlers.h"
 #include "init.h"
+#include "trace.h"
 #include <debug.h>
 #include <fcntl.h>
 #include <kernel.h>
@@ -42,6 +43,15 @@ void fail(const char *str, ...) {
 
   initScreen();
 
+#ifdef TRACE
+  char failMsg[21];
+  va_list traceArgs;
+  va_copy(traceArgs, args);
+  vsnprintf(failMsg, sizeof(failMsg), str, traceArgs);
+  va_end(traceArgs);
+  traceEvent(Trace_Fail, 0, failMsg);
+#endif
+
   scr_vprintf(str, args);
 
   va_end(args);
@@ -63,6 +73,7 @@ int tryFile(char *filepath) {
 // Attempts to launch ELF from device and path in path
 int launchPath(int argc, char *argv[]) {
   int ret = 0;
+  traceEvent(Trace_PathTry, 0, argv[0]);
   switch (guessDeviceType(argv[0])) {
   case Device_MemoryCard:
     ret = handleMC(argc, argv);
@@ -108,9 +119,10 @@ int launchPath(int argc, char *argv[]) {
     break;
 #endif
   default:
-    return -ENODEV;
+    ret = -ENODEV;
   }
 
+  traceEvent(Trace_PathResult, ret, argv[0]);
   return ret;
 }
 
@@ -217,6 +229,7 @@ char *normalizePath(char *path, DeviceType type) {
 
     strcpy(pathbuffer, BDM_MOUNTPOINT);
     strncat(pathbuffer, path, PATH_MAX - sizeof(BDM_MOUNTPOINT));
+    break;
   default:
     return NULL;
   }
@@ -0,0 +1,175 @@
+#include "disc_cache.h"
+#include "common.h"
+#include "game_id_table.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+#define DISC_CACHE_CAPACITY 32 // Number of discs kept in the cache
+#define DISC_CACHE_VERSION 2
+#define DISC_CACHE_REFRESH_AGE (DISC_CACHE_CAPACITY / 2) // Cache hits only refresh records that are older than this
+
+// Cache file header, followed by DISC_CACHE_CAPACITY records
+typedef struct {
+  char magic[4];         // "ODCC"
+  uint16_t version;      // DISC_CACHE_VERSION
+  uint16_t recordSize;   // sizeof(DiscCacheRecord)
+  uint32_t capacity;     // Number of record slots
+  uint32_t counter;      // Incremented every time a record is added or refreshed
+  uint32_t tableVersion; // gameIDTableVersion the title IDs were looked up with
+} DiscCacheHeader;
+
+// Cached disc metadata
+typedef struct {
+  char volumeTimestamp[16]; // PVD volume creation date
+  uint32_t volumeSize;      // PVD volume space size
+  uint32_t lastUsed;        // Header counter value at the time the record was last used, 0 for empty records
+  int32_t discType;
+  char titleID[12];
+  char titleVersion[12];
+  char bootPath[76];
+} DiscCacheRecord;
+
+// The 'X' in "mcX" will be replaced with memory card number
+static char cacheFilePath[] = "mcX:/SYS-CONF/DISCCACHE.BIN";
+
+static DiscCacheHeader cacheHeader;
+static DiscCacheRecord cacheRecords[DISC_CACHE_CAPACITY];
+static int cacheCard = -1;  // Memory card the cache was read from
+static int cacheDirty = -1; // Index of the changed record
+
+// Reads the disc metadata cache from the memory card
+void discCacheLoad() {
+  int fd = -1;
+  for (cacheCard = 0; cacheCard < 2; cacheCard++) {
+    cacheFilePath[2] = cacheCard + '0';
+    if ((fd = open(cacheFilePath, O_RDONLY)) >= 0)
+      break;
+  }
+
+  if (fd >= 0) {
+    if ((read(fd, &cacheHeader, sizeof(cacheHeader)) == sizeof(cacheHeader)) && !memcmp(cacheHeader.magic, "ODCC", 4) &&
+        (cacheHeader.version == DISC_CACHE_VERSION) && (cacheHeader.recordSize == sizeof(DiscCacheRecord)) &&
+        (cacheHeader.capacity == DISC_CACHE_CAPACITY) && (cacheHeader.tableVersion == gameIDTableVersion) &&
+        (read(fd, cacheRecords, sizeof(cacheRecords)) == sizeof(cacheRecords))) {
+      close(fd);
+      return;
+    }
+    DPRINTF("Disc cache at %s is invalid, reinitializing\n", cacheFilePath);
+    close(fd);
+  }
+
+  // The whole file will be written on save
+  cacheCard = -1;
+  memset(&cacheHeader, 0, sizeof(cacheHeader));
+  memset(cacheRecords, 0, sizeof(cacheRecords));
+  memcpy(cacheHeader.magic, "ODCC", 4);
+  cacheHeader.version = DISC_CACHE_VERSION;
+  cacheHeader.recordSize = sizeof(DiscCacheRecord);
+  cacheHeader.capacity = DISC_CACHE_CAPACITY;
+  cacheHeader.tableVersion = gameIDTableVersion;
+}
+
+// Returns the index of the record matching the disc or -1 if the disc is not cached
+static int discCacheFind(ISODiscInfo *info) {
+  if ((info->volumeTimestamp[0] == '\0') || !info->volumeSize)
+    return -1;
+
+  for (int i = 0; i < DISC_CACHE_CAPACITY; i++) {
+    if (cacheRecords[i].lastUsed && (cacheRecords[i].volumeSize == info->volumeSize) &&
+        !memcmp(cacheRecords[i].volumeTimestamp, info->volumeTimestamp, sizeof(cacheRecords[i].volumeTimestamp)))
+      return i;
+  }
+  return -1;
+}
+
+// Looks up the disc by its PVD volume creation date and volume size.
+// Copies cached values into bootPath, titleID and titleVersion and returns the disc type or -ENOENT if the disc is not cached
+int discCacheLookup(ISODiscInfo *info, char *bootPath, char *titleID, char *titleVersion) {
+  int i = discCacheFind(info);
+  if (i < 0)
+    return -ENOENT;
+
+  DiscCacheRecord *record = &cacheRecords[i];
+  DPRINTF("Disc cache hit: %s %s %s\n", record->bootPath, record->titleID, record->titleVersion);
+  strncpy(bootPath, record->bootPath, sizeof(record->bootPath) - 1);
+  strncpy(titleID, record->titleID, sizeof(record->titleID) - 1);
+  strncpy(titleVersion, record->titleVersion, sizeof(record->titleVersion) - 1);
+  return record->discType;
+}
+
+// Adds the disc to the cache, evicting the least recently used disc if the cache is full.
+// Cached discs are only marked as recently used once they are about to be evicted, so most launches don't write to the memory card.
+// Changes are written to the memory card by discCacheSave
+void discCacheUpdate(ISODiscInfo *info, int discType, const char *bootPath, const char *titleID, const char *titleVersion) {
+  if ((info->volumeTimestamp[0] == '\0') || !info->volumeSize)
+    return;
+
+  int slot = discCacheFind(info);
+  if (slot < 0) {
+    // Values that don't fit into the record are not cached
+    if ((strlen(bootPath) >= sizeof(cacheRecords[0].bootPath)) || (strlen(titleID) >= sizeof(cacheRecords[0].titleID)) ||
+        (strlen(titleVersion) >= sizeof(cacheRecords[0].titleVersion)))
+      return;
+
+    // Find an empty or the least recently used record
+    slot = 0;
+    for (int i = 1; i < DISC_CACHE_CAPACITY && cacheRecords[slot].lastUsed; i++) {
+      if (cacheRecords[i].lastUsed < cacheRecords[slot].lastUsed)
+        slot = i;
+    }
+
+    DiscCacheRecord *record = &cacheRecords[slot];
+    memset(record, 0, sizeof(DiscCacheRecord));
+    memcpy(record->volumeTimestamp, info->volumeTimestamp, sizeof(record->volumeTimestamp));
+    record->volumeSize = info->volumeSize;
+    record->discType = discType;
+    strcpy(record->bootPath, bootPath);
+    strcpy(record->titleID, titleID);
+    strcpy(record->titleVersion, titleVersion);
+  } else if (cacheHeader.counter - cacheRecords[slot].lastUsed < DISC_CACHE_REFRESH_AGE)
+    // Recently added or refreshed, not worth a memory card write
+    return;
+
+  cacheRecords[slot].lastUsed = ++cacheHeader.counter;
+  cacheDirty = slot;
+}
+
+// Writes the changed cache record to the memory card
+void discCacheSave() {
+  if (cacheDirty < 0)
+    return;
+
+  int fd = -1;
+  if (cacheCard >= 0) {
+    // Update the header and the changed record in place
+    cacheFilePath[2] = cacheCard + '0';
+    if ((fd = open(cacheFilePath, O_WRONLY)) >= 0) {
+      if (write(fd, &cacheHeader, sizeof(cacheHeader)) != sizeof(cacheHeader) ||
+          lseek(fd, sizeof(cacheHeader) + cacheDirty * sizeof(DiscCacheRecord), SEEK_SET) < 0 ||
+          write(fd, &cacheRecords[cacheDirty], sizeof(DiscCacheRecord)) != sizeof(DiscCacheRecord))
+        DPRINTF("ERROR: Failed to update the disc cache\n");
+      close(fd);
+      cacheDirty = -1;
+      return;
+    }
+  }
+
+  // Write the whole file to the first available card
+  for (int i = 0; i < 2 && fd < 0; i++) {
+    cacheFilePath[2] = i + '0';
+    fd = open(cacheFilePath, O_WRONLY | O_CREAT | O_TRUNC);
+  }
+  if (fd < 0) {
+    DPRINTF("ERROR: Failed to create the disc cache: %d\n", fd);
+    return;
+  }
+
+  if ((write(fd, &cacheHeader, sizeof(cacheHeader)) != sizeof(cacheHeader)) ||
+      (write(fd, cacheRecords, sizeof(cacheRecords)) != sizeof(cacheRecords)))
+    DPRINTF("ERROR: Failed to write the disc cache\n");
+  close(fd);
+  cacheDirty = -1;
+}
@@ -1,16 +1,26 @@
 // GS functions
 // Based on code by Tony Saveski, t_saveski@yahoo.com
 #include "common.h"
-#include <dmaKit.h>
-#include <gsKit.h>
-#include <stdint.h>
-#include <stdio.h>
+#include "gs.h"
+#include <dma.h>
 #include <kernel.h>
+#include <stdint.h>
+#include <string.h>
 
 //
 // GameID code based on https://github.com/CosmicScale/Retro-GEM-PS2-Disc-Launcher
 //
 
+#define GAMEID_MAX_DATA 18                      // Detect word, offset, CRC, length, 11-character title ID, terminator, end word and padding
+#define GAMEID_MAX_WIDTH (GAMEID_MAX_DATA * 16) // Every bit is two pixels wide
+#define GAMEID_HEIGHT 2                         // Barcode height in pixels
+#define GAMEID_IMAGE_QWORDS (GAMEID_MAX_WIDTH * GAMEID_HEIGHT / 4)
+
+// Barcode colors
+#define GAMEID_COLOR_SEPARATOR 0x00FF00FF // Magenta
+#define GAMEID_COLOR_ONE 0x00FFFF00       // Cyan
+#define GAMEID_COLOR_ZERO 0x0000FFFF      // Yellow
+
 static uint8_t calculateCRC(const uint8_t *data, int len) {
   uint8_t crc = 0x00;
   for (int i = 0; i < len; i++) {
@@ -19,25 +29,86 @@ static uint8_t calculateCRC(const uint8_t *data, int len) {
   return 0x100 - crc;
 }
 
-// Initializes GS and displays visual game ID
-void gsDisplayGameID(const char *gameID) {
-  GSGLOBAL *gsGlobal = gsKit_init_global();
-  gsGlobal->DoubleBuffering = GS_SETTING_ON;
+// Screen size for the current video mode
+static uint16_t gsWidth = 0;
+static uint16_t gsHeight = 0;
+
+// Transfer registers, image GIF tag and the barcode image
+DECLARE_GS_PACKET(gsDMABuf, GAMEID_IMAGE_QWORDS + 6);
+
+// Resets GS and sets up a single 640x448 (NTSC) or 640x512 (PAL) frame buffer
+static void gsInit() {
+  // Get the video mode from the console region
+  char romname[15];
+  GetRomName(romname);
+  GSVideoMode mode = (romname[4] == 'E') ? GS_MODE_PAL : GS_MODE_NTSC;
+
+  gsWidth = 640;
+  gsHeight = (mode == GS_MODE_PAL) ? 512 : 448;
+
+  // Reset DMA
+  dma_reset();
+  // Reset GS
+  *(volatile uint64_t *)GS_REG_CSR = 0x200;
+  // Mask interrupts
+  GsPutIMR(0xff00);
+  // Configure GS CRT
+  SetGsCrt(1, mode, 0);
+
+  GS_SET_PMODE(0,   // ReadCircuit1 OFF
+               1,   // ReadCircuit2 ON
+               1,   // Use ALP register for Alpha Blending
+               1,   // Alpha Value of ReadCircuit2 for output selection
+               0,   // Blend Alpha with the output of ReadCircuit2
+               0xFF // Alpha Value = 1.0
+  );
 
-  dmaKit_init(D_CTRL_RELE_OFF, D_CTRL_MFD_OFF, D_CTRL_STS_UNSPEC, D_CTRL_STD_OFF, D_CTRL_RCYC_8, 1 << DMA_CHANNEL_GIF);
+  GS_SET_DISPFB2(0,            // Frame Buffer base pointer = 0 (Address/2048)
+                 gsWidth / 64, // Buffer Width (Address/64)
+                 0,            // Pixel Storage Format
+                 0,            // Upper Left X in Buffer = 0
+                 0             // Upper Left Y in Buffer = 0
+  );
 
-  // Initialize the DMAC
-  int res;
-  if ((res = dmaKit_chan_init(DMA_CHANNEL_GIF)))
+  GS_SET_DISPLAY2(656,             // X position in the display area (in VCK units)
+                  36,              // Y position in the display area (in Raster units)
+                  3,               // Horizontal Magnification - 1
+                  0,               // Vertical Magnification = 1x
+                  gsWidth * 4 - 1, // Display area width  - 1 (in VCK units) (Width*HMag-1)
+                  gsHeight - 1     // Display area height - 1 (in pixels)	  (Height-1)
+  );
+
+  GS_SET_BGCOLOR(0, 0, 0);
+
+  // Set up the frame buffer and draw black rectangle over it
+  BEGIN_GS_PACKET(gsDMABuf);
+  GIF_TAG_AD(gsDMABuf, 7, 1, 0, 0, 0);
+  GIF_DATA_AD(gsDMABuf, GS_REG_FRAME_1, GS_FRAME(0, gsWidth / 64, 0, 0));
+  // No displacement between Primitive and Window coordinate systems.
+  GIF_DATA_AD(gsDMABuf, GS_REG_XYOFFSET_1, GS_XYOFFSET(0x0, 0x0));
+  // Clip to frame buffer.
+  GIF_DATA_AD(gsDMABuf, GS_REG_SCISSOR_1, GS_SCISSOR(0, gsWidth - 1, 0, gsHeight - 1));
+  GIF_DATA_AD(gsDMABuf, GS_REG_PRIM, GS_PRIM(PRIM_SPRITE, 0, 0, 0, 0, 0, 0, 0, 0));
+  GIF_DATA_AD(gsDMABuf, GS_REG_RGBAQ, GS_RGBAQ(0, 0, 0, 0, 0));
+  GIF_DATA_AD(gsDMABuf, GS_REG_XYZ2, GS_XYZ2(0, 0, 0));
+  GIF_DATA_AD(gsDMABuf, GS_REG_XYZ2, GS_XYZ2(gsWidth << 4, gsHeight << 4, 0));
+  SEND_GS_PACKET(gsDMABuf);
+}
+
+// Initializes GS and clears the screen.
+// Called early to overlap GS setup with the disc spin-up
+void gsInitGameID() {
+  if (gsWidth)
     return;
 
-  // Init screen
-  gsKit_init_screen(gsGlobal);
-  gsKit_display_buffer(gsGlobal); // Switch display buffer to avoid garbage appearing on screen
-  gsKit_mode_switch(gsGlobal, GS_ONESHOT);
-  gsKit_clear(gsGlobal, GS_SETREG_RGBA(0x00, 0x00, 0x00, 0x00));
+  gsInit();
+}
 
-  uint8_t data[64] = {0};
+// Initializes GS if needed and displays visual game ID
+void gsDisplayGameID(const char *gameID) {
+  gsInitGameID();
+
+  uint8_t data[GAMEID_MAX_DATA] = {0};
   int gidlen = strnlen(gameID, 11); // Ensure the length does not exceed 11 characters
 
   int dpos = 0;
@@ -56,23 +127,32 @@ void gsDisplayGameID(const char *gameID) {
   int data_len = dpos;
   data[2] = calculateCRC(&data[3], data_len - 3);
 
-  int xstart = (gsGlobal->Width / 2) - (data_len * 8);
-  int ystart = gsGlobal->Height - (((gsGlobal->Height / 8) * 2) + 20);
-  int height = 2;
+  int width = data_len * 16;
+  int xstart = (gsWidth / 2) - (data_len * 8);
+  int ystart = gsHeight - (((gsHeight / 8) * 2) + 20);
 
+  // Build the whole barcode as a single image transfer and send it with one DMA
+  BEGIN_GS_PACKET(gsDMABuf);
+  GIF_TAG_AD(gsDMABuf, 4, 1, 0, 0, 0);
+  GIF_DATA_AD(gsDMABuf, GS_REG_BITBLTBUF, GS_BITBLTBUF(0, 0, 0, 0, gsWidth / 64, 0));
+  GIF_DATA_AD(gsDMABuf, GS_REG_TRXPOS, GS_TRXPOS(0, 0, xstart, ystart, 0)); // left to right/top to bottom
+  GIF_DATA_AD(gsDMABuf, GS_REG_TRXREG, GS_TRXREG(width, GAMEID_HEIGHT));
+  GIF_DATA_AD(gsDMABuf, GS_REG_TRXDIR, GS_TRXDIR(XDIR_EE_GS));
+  GIF_TAG_IMG(gsDMABuf, width * GAMEID_HEIGHT / 4);
+
+  // Every bit is drawn as a separator pixel followed by the bit value pixel
+  uint32_t *pixels = (uint32_t *)&gsDMABuf[gsDMABuf_cur];
   for (int i = 0; i < data_len; i++) {
     for (int j = 7; j >= 0; j--) {
-      int x = xstart + (i * 16 + ((7 - j) * 2));
-      int x1 = x + 1;
-      gsKit_prim_sprite(gsGlobal, x, ystart, x1, ystart + height, 0, GS_SETREG_RGBA(0xFF, 0x00, 0xFF, 0x00));
-
-      uint32_t color = (data[i] >> j) & 1 ? GS_SETREG_RGBA(0x00, 0xFF, 0xFF, 0x00) : GS_SETREG_RGBA(0xFF, 0xFF, 0x00, 0x00);
-      gsKit_prim_sprite(gsGlobal, x1, ystart, x1 + 1, ystart + height, 0, color);
+      *pixels++ = GAMEID_COLOR_SEPARATOR;
+      *pixels++ = ((data[i] >> j) & 1) ? GAMEID_COLOR_ONE : GAMEID_COLOR_ZERO;
     }
   }
+  // Repeat the first row for the rest of the barcode
+  for (int i = 1; i < GAMEID_HEIGHT; i++)
+    memcpy(&gsDMABuf[gsDMABuf_cur + i * width / 2], &gsDMABuf[gsDMABuf_cur], width * 4);
 
-  // Execute the queue
-  gsKit_queue_exec(gsGlobal);
-  gsKit_finish();
-  gsKit_sync_flip(gsGlobal);
+  // Registers, image tag and image data
+  gsDMABuf_dma_size = 6 + width * GAMEID_HEIGHT / 4;
+  SEND_GS_PACKET(gsDMABuf);
 }
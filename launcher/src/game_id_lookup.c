@@ -0,0 +1,36 @@
+#include "game_id_table.h"
+#include "common.h"
+#include <ctype.h>
+#include <errno.h>
+#include <string.h>
+
+// Attempts to guess PS1 title ID from volume creation date stored in PVD.
+// Copies the title ID into titleID and returns 0 if the disc is in the table
+int getPS1GenericTitleID(ISODiscInfo *info, char *titleID) {
+  // Encode the timestamp as BCD key
+  uint64_t key = 0;
+  for (int i = 0; i < 16; i++) {
+    if (!isdigit((int)info->volumeTimestamp[i])) {
+      DPRINTF("Invalid PVD\n");
+      return -ENOENT;
+    }
+    key = (key << 4) | (info->volumeTimestamp[i] - '0');
+  }
+
+  // Binary search the sorted table
+  int low = 0;
+  int high = gameIDCount - 1;
+  while (low <= high) {
+    int mid = (low + high) / 2;
+    if (gameIDTimestamps[mid] < key)
+      low = mid + 1;
+    else if (gameIDTimestamps[mid] > key)
+      high = mid - 1;
+    else {
+      memcpy(titleID, gameIDs[mid], GAME_ID_LENGTH);
+      titleID[GAME_ID_LENGTH] = '\0';
+      return 0;
+    }
+  }
+  return -ENOENT;
+}
@@ -1,13 +1,116 @@
 #include "common.h"
 #include "init.h"
 #include "loader.h"
+#include "trace.h"
 #include <fcntl.h>
 #include <ps2sdkapi.h>
 #include <stdio.h>
 #include <string.h>
+#include <unistd.h>
+#ifdef UDPBD
+#define NEWLIB_PORT_AWARE
+#include <fileXio_rpc.h>
+#include <smap_udpbd.h>
+#include <stdarg.h>
+#endif
 
 char bdmMountpoint[] = BDM_MOUNTPOINT;
 #define BDM_MAX_DEVICES 10
+#define BDM_WAIT_INTERVAL 50000 // Interval between mountpoint checks in microseconds
+#define BDM_WAIT_TIMEOUT 20     // Max time to wait for the first device in seconds
+
+#ifdef UDPBD
+#define UDPBD_LOG_MAX_SIZE 16384 // The log is started over once it grows past this
+
+// The 'X' in "mcX" will be replaced with memory card number
+static char udpbdLogPath[] = "mcX:/SYS-CONF/UDPBDLOG.TXT";
+
+// Appends formatted text to buf, never writing past size
+static void appendStats(char *buf, int *pos, int size, const char *fmt, ...) {
+  va_list args;
+  va_start(args, fmt);
+  int res = vsnprintf(&buf[*pos], size - *pos, fmt, args);
+  va_end(args);
+  if (res > 0)
+    *pos = (*pos + res < size) ? *pos + res : size - 1;
+}
+
+// Formats the counters kept by the smap_udpbd module, skipping empty histogram buckets.
+// Returns the length of the text or -1 if the module doesn't respond
+static int formatUDPBDStats(char *buf, int size) {
+  struct udpbd_io_stats io;
+  struct udpbd_cache_stats cache;
+  struct smap_rx_stats rx;
+  struct smap_tx_stats tx;
+  struct smap_link_stats link;
+
+  if (fileXioDevctl(UDPBD_DEVNAME ":", UDPBD_DEVCTL_GET_IO_STATS, NULL, 0, &io, sizeof(io)) < 0 ||
+      fileXioDevctl(UDPBD_DEVNAME ":", UDPBD_DEVCTL_GET_CACHE_STATS, NULL, 0, &cache, sizeof(cache)) < 0 ||
+      fileXioDevctl(UDPBD_DEVNAME ":", UDPBD_DEVCTL_GET_RX_STATS, NULL, 0, &rx, sizeof(rx)) < 0 ||
+      fileXioDevctl(UDPBD_DEVNAME ":", UDPBD_DEVCTL_GET_TX_STATS, NULL, 0, &tx, sizeof(tx)) < 0 ||
+      fileXioDevctl(UDPBD_DEVNAME ":", UDPBD_DEVCTL_GET_LINK_STATS, NULL, 0, &link, sizeof(link)) < 0)
+    return -1;
+
+  int pos = 0;
+  appendStats(buf, &pos, size, "UDPBD: link mode 0x%x up after %uus%s, server found after %uus (%u requests), %u byte RDMA blocks\n",
+              link.link_mode, link.link_up_time, link.fast_link ? " (reused)" : "", link.discovery_time, link.discovery_tries,
+              link.rdma_block_size);
+  appendStats(buf, &pos, size, "UDPBD: %u reads (%u bytes), %u writes (%u bytes)\n", io.reads, io.bytes_read, io.writes, io.bytes_written);
+  appendStats(buf, &pos, size,
+              "UDPBD: %u retries, %u timeouts, %u out of order, %u bad size, %u write errors, %u stale, %u duplicates, %u disconnects\n",
+              io.retries, io.timeouts, io.bad_cmdpkt, io.bad_size, io.write_errors, io.stale, io.duplicates, io.disconnects);
+  appendStats(buf, &pos, size, "UDPBD: cache %u hits, %u misses, %u prefetched, %u evictions\n", cache.hits, cache.misses, cache.prefetched,
+              cache.evictions);
+  appendStats(buf, &pos, size, "UDPBD: rx %u frames (%u polled, %u interrupts), dropped %u error, %u type, %u arp, %u proto, %u port\n",
+              rx.frames, rx.polled, rx.interrupts, rx.drop_error, rx.drop_type, rx.drop_arp, rx.drop_proto, rx.drop_port);
+  appendStats(buf, &pos, size,
+              "UDPBD: tx %u frames (%u bytes), %u ring full (%u timed out), %u dropped busy, %u dropped full, %u tty bytes dropped\n",
+              tx.frames, tx.bytes, tx.ring_full, tx.wait_timeouts, tx.drop_busy, tx.drop_full, tx.tty_dropped);
+  for (int i = 0; i < UDPBD_HIST_BUCKETS; i++) {
+    if (io.read_hist[i])
+      appendStats(buf, &pos, size, "UDPBD: read %7uus+: %u\n", 1u << i, io.read_hist[i]);
+  }
+  for (int i = 0; i < UDPBD_HIST_BUCKETS; i++) {
+    if (io.write_hist[i])
+      appendStats(buf, &pos, size, "UDPBD: write %7uus+: %u\n", 1u << i, io.write_hist[i]);
+  }
+  return pos;
+}
+
+// Prints the UDPBD statistics and appends them to mc?:/SYS-CONF/UDPBDLOG.TXT.
+// The log is only written if the file already exists, so creating it enables logging in release builds
+static void saveUDPBDStats(const char *elfPath) {
+  static char stats[4096];
+  int len = formatUDPBDStats(stats, sizeof(stats));
+  if (len < 0) {
+    DPRINTF("UDPBD: failed to get statistics\n");
+    return;
+  }
+  DPRINTF("%s", stats);
+
+  int fd = -1;
+  for (char i = '0'; i < '2' && fd < 0; i++) {
+    udpbdLogPath[2] = i;
+    fd = open(udpbdLogPath, O_WRONLY);
+  }
+  if (fd < 0)
+    return;
+
+  if (lseek(fd, 0, SEEK_END) > UDPBD_LOG_MAX_SIZE) {
+    close(fd);
+    if ((fd = open(udpbdLogPath, O_WRONLY | O_TRUNC)) < 0)
+      return;
+  }
+
+  char header[128];
+  int headerLen = snprintf(header, sizeof(header), "--- %s\n", elfPath);
+  if (headerLen >= (int)sizeof(header))
+    headerLen = sizeof(header) - 1;
+  if (write(fd, header, headerLen) != headerLen || write(fd, stats, len) != len)
+    DPRINTF("UDPBD: failed to write %s\n", udpbdLogPath);
+  close(fd);
+}
+#endif
 
 // Launches ELF from BDM device
 int handleBDM(DeviceType device, int argc, char *argv[]) {
@@ -26,7 +129,8 @@ int handleBDM(DeviceType device, int argc, char *argv[]) {
 
   // Try all BDM devices while decreasing the number of wait
   // attempts for each consecutive device to reduce init times
-  int delayAttempts = 20; // Max number of attempts
+  // Poll often, so devices that show up quickly (e.g. UDPBD with the link already up) are not held back a whole second
+  int delayAttempts = BDM_WAIT_TIMEOUT * (1000000 / BDM_WAIT_INTERVAL); // Max number of attempts
   for (int i = 0; i < BDM_MAX_DEVICES; i++) {
     // Build mountpoint path
     bdmMountpoint[4] = i + '0';
@@ -37,6 +141,7 @@ int handleBDM(DeviceType device, int argc, char *argv[]) {
       if (res >= 0) {
         // If mountpoint is available
         close(res);
+        traceEvent(Trace_DeviceReady, 0, bdmMountpoint);
 
         // Jump to launch if file exists
         if (!(res = tryFile(elfPath)))
@@ -45,16 +150,22 @@ int handleBDM(DeviceType device, int argc, char *argv[]) {
         break;
       }
       // If the mountpoitnt is unavailable, delay and decrement the number of wait attempts
-      sleep(1);
+      usleep(BDM_WAIT_INTERVAL);
       delayAttempts--;
     }
     // No more mountpoints available
-    if (res < 0)
+    if (res < 0) {
+      traceEvent(Trace_DeviceReady, res, bdmMountpoint);
       break;
+    }
   }
   return -ENODEV;
 
 found:
+#ifdef UDPBD
+  if (device == Device_UDPBD)
+    saveUDPBDStats(elfPath);
+#endif
   argv[0] = elfPath;
   return LoadELFFromFile(argc, argv);
 }
@@ -1,11 +1,13 @@
 #include "common.h"
 #include "defaults.h"
+#include "disc_cache.h"
 #include "game_id.h"
 #include "game_id_table.h"
 #include "history.h"
 #include "init.h"
+#include "iso9660.h"
 #include "loader.h"
-#include <ctype.h>
+#include "trace.h"
 #include <fcntl.h>
 #include <kernel.h>
 #include <libcdvd.h>
@@ -15,17 +17,44 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 
 typedef enum {
   DiscType_PS1,
   DiscType_PS2,
 } DiscType;
 
-const char *getPS1GenericTitleID();
-int parseDiscCNF(char *bootPath, char *titleID, char *titleVersion);
+int parseDiscCNF(ISODiscInfo *info, char *bootPath, char *titleID, char *titleVersion);
 int startCDROM(int displayGameID, int skipPS2LOGO, char *dkwdrvPath);
 
 #define MAX_STR 256
+#define MAX_CNF_SIZE 2048
+#define DISC_POLL_INTERVAL 10000     // Interval between disc type checks in microseconds
+#define DISC_DETECT_TIMEOUT 30000000 // Max time to wait for the disc to be detected in microseconds
+
+// Polls the drive until the disc is detected and the drive is ready.
+// Waits indefinitely while there's no disc in the drive
+static int waitForDisc(int *discType) {
+  int attempts = DISC_DETECT_TIMEOUT / DISC_POLL_INTERVAL;
+  int isWaiting = 0;
+
+  while (1) {
+    *discType = sceCdGetDiskType();
+    if (*discType == SCECdNODISC) {
+      if (!isWaiting) {
+        msg("\n\nWaiting for disc\n");
+        isWaiting = 1;
+      }
+      // Restart the deadline once the disc is inserted
+      attempts = DISC_DETECT_TIMEOUT / DISC_POLL_INTERVAL;
+    } else if ((*discType >= SCECdUNKNOWN) && (sceCdDiskReady(1) == SCECdComplete))
+      return 0;
+    else if (--attempts <= 0)
+      return -ETIMEDOUT;
+
+    usleep(DISC_POLL_INTERVAL);
+  }
+}
 
 // Launches the disc while displaying the visual game ID and writing to the history file
 int handleCDROM(int argc, char *argv[]) {
@@ -95,46 +124,67 @@ int startCDROM(int displayGameID, int skipPS2LOGO, char *dkwdrvPath) {
   if (skipPS2LOGO)
     DPRINTF("CDROM: Skipping PS2LOGO\n");
 
-  // Wait until the drive is ready
-  sceCdDiskReady(0);
+  // Read the disc cache and probe memory cards for history files while the drive spins up
+  discCacheLoad();
+  startHistoryUpdate();
+
+  // Set up GS while the drive spins up, unless the "Waiting for disc" message is about to be displayed
   int discType = sceCdGetDiskType();
+  if (displayGameID && (discType != SCECdNODISC))
+    gsInitGameID();
 
-  if ((discType >= SCECdNODISC) && (discType < SCECdUNKNOWN)) {
-    msg("\n\nWaiting for disc\n");
-    while ((discType >= SCECdNODISC) && (discType < SCECdUNKNOWN)) {
-      sleep(1);
-      discType = sceCdGetDiskType();
-    }
+  // Wait until the drive is ready
+  if ((res = waitForDisc(&discType))) {
+    msg("CDROM ERROR: Timed out waiting for the disc\n");
+    setHistoryTitleID(NULL);
+    waitHistoryUpdate();
+    return res;
   }
 
   // Make sure the disc is a valid PS1/PS2 disc
-  discType = sceCdGetDiskType();
+  traceEvent(Trace_DiscType, discType, NULL);
   if (!(discType >= SCECdPSCD || discType <= SCECdPS2DVD)) {
     msg("CDROM ERROR: Unsupported disc type\n");
+    setHistoryTitleID(NULL);
+    waitHistoryUpdate();
     return -EINVAL;
   }
 
-  // Parse SYSTEM.CNF
+  // Read the PVD and try to find the disc in the cache, parsing SYSTEM.CNF only on cache miss
+  ISODiscInfo discInfo;
   char *bootPath = calloc(sizeof(char), MAX_STR);
   char *titleID = calloc(sizeof(char), 12);
   char *titleVersion = calloc(sizeof(char), MAX_STR);
-  discType = parseDiscCNF(bootPath, titleID, titleVersion);
+  if (isoReadVolumeInfo(&discInfo) || ((discType = discCacheLookup(&discInfo, bootPath, titleID, titleVersion)) < 0))
+    discType = parseDiscCNF(&discInfo, bootPath, titleID, titleVersion);
+  if (discType >= 0)
+    discCacheUpdate(&discInfo, discType, bootPath, titleID, titleVersion);
+  isoFreeDiscInfo(&discInfo);
+  traceEvent(Trace_DiscCNF, discType, titleID);
   if (discType < 0) {
     msg("CDROM ERROR: Failed to parse SYSTEM.CNF\n");
+    setHistoryTitleID(NULL);
+    waitHistoryUpdate();
     free(bootPath);
     free(titleID);
     free(titleVersion);
     return -ENOENT;
   }
 
+  // Pass the title ID to the history thread. Only the memory card probe and the history file reads overlap the disc wait:
+  // the thread runs at the main thread's priority and gsDisplayGameID() doesn't block, so the files are written in waitHistoryUpdate()
+  setHistoryTitleID(titleID);
   if (titleID[0] != '\0') {
-    // Update history file and display game ID
-    updateHistoryFile(titleID);
     if (displayGameID)
       gsDisplayGameID(titleID);
   } else
     strcpy(titleID, "???"); // Set placeholder value
 
+  // History files must be written before the game starts
+  waitHistoryUpdate();
+  // Save the disc cache after the history thread is done with memory cards
+  discCacheSave();
+
   if (titleVersion[0] == '\0')
     // Set placeholder value
     strcpy(titleVersion, "???");
@@ -153,6 +203,8 @@ int startCDROM(int displayGameID, int skipPS2LOGO, char *dkwdrvPath) {
     } else {
       char *argv[] = {titleID, titleVersion};
       DPRINTF("Starting PS1DRV with title ID %s and version %s\n", argv[0], argv[1]);
+      traceEvent(Trace_Exec, 0, "rom0:PS1DRV");
+      traceFlush();
       sceSifExitCmd();
       LoadExecPS2("rom0:PS1DRV", 2, argv);
     }
@@ -164,10 +216,14 @@ int startCDROM(int displayGameID, int skipPS2LOGO, char *dkwdrvPath) {
       if (titleID[0] != '\0')
         applyXPARAM(titleID);
 
+      traceEvent(Trace_Exec, 0, bootPath);
+      traceFlush();
       sceSifExitCmd();
       // Launch PS2 game directly
       LoadExecPS2(bootPath, 0, NULL);
     } else {
+      traceEvent(Trace_Exec, 0, bootPath);
+      traceFlush();
       sceSifExitCmd();
       // Launch PS2 game with rom0:PS2LOGO
       char *argv[] = {bootPath};
@@ -181,56 +237,72 @@ int startCDROM(int displayGameID, int skipPS2LOGO, char *dkwdrvPath) {
   return -1;
 }
 
-// Parses SYSTEM.CNF on disc into bootPath, titleID and titleVersion
-// Returns disc type or a negative number if an error occurs
-int parseDiscCNF(char *bootPath, char *titleID, char *titleVersion) {
-  // Open SYSTEM.CNF
+// Reads SYSTEM.CNF with cdvdfsv into info->buffer.
+// Used only when SYSTEM.CNF can't be read directly
+int readDiscCNFFile(ISODiscInfo *info) {
   int fd = open("cdrom0:\\SYSTEM.CNF;1", O_RDONLY);
-  if (fd < 0) {
-    // Apparently not all PS1 titles have SYSTEM.CNF
-    // Try to guess the title ID from the disc PVD
-    const char *tID = getPS1GenericTitleID();
-    if (tID) {
-      DPRINTF("Guessed the title ID from disc PVD: %s\n", tID);
-      strncpy(titleID, tID, 11);
-      return DiscType_PS1;
-    }
+  if (fd < 0)
     return -ENOENT;
-  }
 
   // Get the file size
   int size = lseek(fd, 0, SEEK_END);
-  if (size <= 0) {
+  if (size <= 0 || size > MAX_CNF_SIZE) {
     msg("CDROM ERROR: Bad SYSTEM.CNF size\n");
     close(fd);
     return -EIO;
   }
   lseek(fd, 0, SEEK_SET);
 
-  // Read file into memory
-  char *cnf = malloc(size * sizeof(char));
-  if (read(fd, cnf, size) != size) {
+  if (!info->buffer && !(info->buffer = malloc(MAX_CNF_SIZE + 1))) {
+    close(fd);
+    return -ENOMEM;
+  }
+
+  info->cnf = info->buffer;
+  if (read(fd, info->cnf, size) != size) {
     msg("CDROM ERROR: Failed to read SYSTEM.CNF\n");
     close(fd);
-    free(cnf);
+    info->cnf = NULL;
     return -EIO;
   }
   close(fd);
 
-  // Open memory buffer as stream
-  FILE *file = fmemopen(cnf, size, "r");
-  if (file == NULL) {
-    msg("CDROM ERROR: Failed to open SYSTEM.CNF for reading\n");
-    free(cnf);
+  info->cnf[size] = '\0';
+  info->cnfSize = size;
+  return 0;
+}
+
+// Parses SYSTEM.CNF on disc into bootPath, titleID and titleVersion.
+// info must be initialized with isoReadVolumeInfo.
+// Returns disc type or a negative number if an error occurs
+int parseDiscCNF(ISODiscInfo *info, char *bootPath, char *titleID, char *titleVersion) {
+  // Read SYSTEM.CNF directly from the disc, falling back to cdvdfsv on errors
+  if (isoReadCNF(info))
+    readDiscCNFFile(info);
+
+  if (!info->cnf) {
+    // Apparently not all PS1 titles have SYSTEM.CNF
+    // Try to guess the title ID from the disc PVD
+    if (!getPS1GenericTitleID(info, titleID)) {
+      DPRINTF("Guessed the title ID from disc PVD: %s\n", titleID);
+      return DiscType_PS1;
+    }
     return -ENOENT;
   }
 
-  char lineBuffer[255] = {0};
+  // Parse the file in place, line by line
+  char *line = info->cnf;
+  char *lineEnd = NULL;
   char *valuePtr = NULL;
   DiscType type = -1;
-  while (fgets(lineBuffer, sizeof(lineBuffer), file)) { // fgets returns NULL if EOF or an error occurs
+  for (; line; line = lineEnd) {
+    // Terminate the line and find the start of the next one
+    lineEnd = strchr(line, '\n');
+    if (lineEnd)
+      *lineEnd++ = '\0';
+
     // Find the start of the value
-    valuePtr = strchr(lineBuffer, '=');
+    valuePtr = strchr(line, '=');
     if (!valuePtr)
       continue;
 
@@ -238,25 +310,23 @@ int parseDiscCNF(char *bootPath, char *titleID, char *titleVersion) {
     do {
       valuePtr++;
     } while (isspace((int)*valuePtr));
-    valuePtr[strcspn(valuePtr, "\r\n")] = '\0';
+    valuePtr[strcspn(valuePtr, "\r")] = '\0';
 
-    if (!strncmp(lineBuffer, "BOOT2", 5)) { // PS2 title
+    if (!strncmp(line, "BOOT2", 5)) { // PS2 title
       type = DiscType_PS2;
       strncpy(bootPath, valuePtr, MAX_STR);
       continue;
     }
-    if (!strncmp(lineBuffer, "BOOT", 4)) { // PS1 title
+    if (!strncmp(line, "BOOT", 4)) { // PS1 title
       type = DiscType_PS1;
       strncpy(bootPath, valuePtr, MAX_STR);
       continue;
     }
-    if (!strncmp(lineBuffer, "VER", 3)) { // Title version
+    if (!strncmp(line, "VER", 3)) { // Title version
       strncpy(titleVersion, valuePtr, MAX_STR);
       continue;
     }
   }
-  fclose(file);
-  free(cnf);
 
   // Get the start of the executable path
   valuePtr = strchr(bootPath, '\\');
@@ -275,43 +345,9 @@ int parseDiscCNF(char *bootPath, char *titleID, char *titleVersion) {
     strncpy(titleID, valuePtr, 11);
   else {
     // Try to guess the title ID from the disc PVD
-    const char *tID = getPS1GenericTitleID();
-    if (tID) {
-      DPRINTF("Guessed the title ID from disc PVD: %s\n", tID);
-      strncpy(titleID, tID, 11);
-    }
+    if (!getPS1GenericTitleID(info, titleID))
+      DPRINTF("Guessed the title ID from disc PVD: %s\n", titleID);
   }
 
   return type;
 }
-
-// Attempts to guess PS1 title ID from volume creation date stored in PVD
-const char *getPS1GenericTitleID() {
-  char sectorData[2048] = {0};
-
-  sceCdRMode mode = {
-      .trycount = 3,
-      .spindlctrl = SCECdSpinNom,
-      .datapattern = SCECdSecS2048,
-  };
-
-  // Read sector 16 (Primary Volume Descriptor)
-  if (!sceCdRead(16, 1, &sectorData, &mode) || sceCdSync(0)) {
-    DPRINTF("Failed to read PVD\n");
-    return NULL;
-  }
-
-  // Make sure the PVD is valid
-  if (strncmp(&sectorData[1], "CD001", 5)) {
-    DPRINTF("Invalid PVD\n");
-    return NULL;
-  }
-
-  // Try to match the volume creation date at offset 0x32D against the table
-  for (size_t i = 0; i < sizeof(gameIDTable) / sizeof(gameIDTable[0]); ++i) {
-    if (strncmp(&sectorData[0x32D], gameIDTable[i].volumeTimestamp, 16) == 0) {
-      return gameIDTable[i].gameID;
-    }
-  }
-  return NULL;
-}
@@ -1,6 +1,7 @@
 #include "common.h"
 #include "defaults.h"
 #include "handlers.h"
+#include "trace.h"
 #include <ctype.h>
 #include <init.h>
 #include <kernel.h>
@@ -54,6 +55,7 @@ int handleFMCB(int argc, char *argv[]) {
   linkedStr *targetPaths = NULL;
   linkedStr *targetArgs = NULL;
   int targetArgc = 1; // argv[0] is the ELF path
+  int pathCount = 0;
 
   char lineBuffer[PATH_MAX] = {0};
   char *valuePtr = NULL;
@@ -82,6 +84,7 @@ int handleFMCB(int argc, char *argv[]) {
 
       if ((strlen(valuePtr) > 0)) {
         targetPaths = addStr(targetPaths, valuePtr);
+        pathCount++;
       }
       continue;
     }
@@ -119,6 +122,7 @@ int handleFMCB(int argc, char *argv[]) {
     }
   }
   fclose(file);
+  traceEvent(Trace_CNFParse, pathCount, cnfPath);
 
   if (!targetPaths) {
     msg("FMCB: No paths found for entry %d\n", targetIdx);
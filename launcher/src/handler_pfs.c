@@ -1,5 +1,6 @@
 #include "init.h"
 #include "loader.h"
+#include "trace.h"
 #include <hdd-ioctl.h>
 #include <ps2sdkapi.h>
 #include <stdio.h>
@@ -46,6 +47,7 @@ int handlePFS(int argc, char *argv[]) {
     }
     sleep(1);
   }
+  traceEvent(Trace_DeviceReady, res, "hdd0:");
   if (res < 0)
     return -ENODEV;
 
@@ -56,8 +58,11 @@ int handlePFS(int argc, char *argv[]) {
 
   // Mount the partition
   DPRINTF("Mounting %s to %s\n", argv[0], PFS_MOUNTPOINT);
-  if (fileXioMount(PFS_MOUNTPOINT, argv[0], FIO_MT_RDONLY))
+  if ((res = fileXioMount(PFS_MOUNTPOINT, argv[0], FIO_MT_RDONLY))) {
+    traceEvent(Trace_DeviceReady, res, argv[0]);
     return -ENODEV;
+  }
+  traceEvent(Trace_DeviceReady, 0, argv[0]);
 
   // Make sure file exists
   if (tryFile(elfPath)) {
@@ -1,4 +1,5 @@
 #include "common.h"
+#include "trace.h"
 #include <ctype.h>
 #include <init.h>
 #include <ps2sdkapi.h>
@@ -43,6 +44,7 @@ int handleQuickboot(char *cnfPath) {
   linkedStr *targetPaths = NULL;
   linkedStr *targetArgs = NULL;
   int targetArgc = 1; // argv[0] is the ELF path
+  int pathCount = 0;
 
   char lineBuffer[PATH_MAX] = {0};
   char relpathBuffer[PATH_MAX] = {0};
@@ -71,12 +73,15 @@ int handleQuickboot(char *cnfPath) {
         // Assemble full path
         snprintf(relpathBuffer, PATH_MAX - 1, "%s/%s", cnfPath, valuePtr);
         targetPaths = addStr(targetPaths, relpathBuffer);
+        pathCount++;
       }
       continue;
     }
     if (!strncmp(lineBuffer, "path", 4)) {
-      if ((strlen(valuePtr) > 0))
+      if ((strlen(valuePtr) > 0)) {
         targetPaths = addStr(targetPaths, valuePtr);
+        pathCount++;
+      }
       continue;
     }
     if (!strncmp(lineBuffer, "arg", 3)) {
@@ -88,6 +93,7 @@ int handleQuickboot(char *cnfPath) {
     }
   }
   fclose(file);
+  traceEvent(Trace_CNFParse, pathCount, cnfPath);
 
   // Build argv, freeing targetArgs
   char **targetArgv = malloc(targetArgc * sizeof(char *));
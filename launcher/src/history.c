@@ -3,6 +3,7 @@
 #include "common.h"
 #include <errno.h>
 #include <fcntl.h>
+#include <kernel.h>
 #include <libcdvd.h>
 #include <libmc.h>
 #include <ps2sdkapi.h>
@@ -30,13 +31,22 @@ struct historyListEntry {
 // Icons of any other size show up as corrupted data
 #define ICON_SYS_SIZE 1776
 
+// Max number of entries in history.old. Evicted entries replace the oldest one once the file is full
+#define MAX_HISTORY_OLD_ENTRIES 64
+// History thread stack size
+#define HISTORY_STACK_SIZE 0x4000
+// libmc passes open flags to mcman as is, so IOP-side values must be used
+#define MC_O_WRONLY 0x0002
+#define MC_O_CREAT 0x0200
+#define MC_O_TRUNC 0x0400
+
 static inline int initSystemDataDir(void);
-void processHistoryList(const char *titleID, struct historyListEntry *historyList);
+int processHistoryList(const char *titleID, struct historyListEntry *historyList);
 int evictEntry(const struct historyListEntry *evictedhistoryEntry);
 static uint16_t getTimestamp(void);
 
 // The 'X' in "BXDATA-SYSTEM" will be replaced with region-specific letter by initSystemDataDir
-// The 'X' in "mcX" will be replaced with memory card number in updateHistoryFile
+// The 'X' in "mcX" will be replaced with memory card number in historyThread
 static char historyFilePath[] = "mcX:/BXDATA-SYSTEM/history";
 extern unsigned char icon_J_sys[];
 extern unsigned char icon_C_sys[];
@@ -81,34 +91,26 @@ int createSystemDataDir() {
   return result;
 }
 
-// Adds title ID to the history file on both mc0 and mc1
-int updateHistoryFile(const char *titleID) {
-  // Refuse to write entry if title ID is less than expected
-  if ((titleID == NULL) || (strlen(titleID) < 11)) {
-    DPRINTF("WARN: Will not write invalid title ID to history files\n");
-    return 0;
-  }
-  // Detect system directory
-  if (initSystemDataDir())
-    return -ENOENT;
+// History files read by historyThread
+static struct historyListEntry historyLists[2][MAX_HISTORY_ENTRIES];
+static int historyValid[2];   // Set if the card can be written to
+static int historyRewrite[2]; // Set if the whole history file must be written
+static char historyTitleID[12];
+static uint16_t historyTimestamp;
 
-  // Initialize libcdvd to get timestamp
-  if (!sceCdInit(SCECdINoD)) {
-    DPRINTF("ERROR: Failed to init libcdvd\n");
-    return -ENODEV;
-  }
+extern void *_gp;
+static uint8_t historyThreadStack[HISTORY_STACK_SIZE] __attribute__((aligned(16)));
+static int historyThreadID = -1;
+static int historyTitleSema = -1; // Signaled when the title ID is set
+static int historyDoneSema = -1;  // Signaled when the thread is done
 
-  if (mcInit(MC_TYPE_XMC)) {
-    DPRINTF("ERROR: Failed to initialize libmc\n");
-    sceCdInit(SCECdEXIT);
-    return -ENODEV;
-  }
-
-  // Try opening history file on mc0 and mc1
+// Probes both memory cards and reads history files into historyLists
+static void readHistoryFiles() {
   int histfileFd, count, mcType, format;
-  struct historyListEntry historyList[MAX_HISTORY_ENTRIES];
 
-  for (char i = 0; i < 2; i++) {
+  for (int i = 0; i < 2; i++) {
+    historyValid[i] = 0;
+    historyRewrite[i] = 0;
     // Check that memory card exists, connected and is a formatted PS2 memory card
     mcGetInfo(i, 0, &mcType, NULL, &format);
     mcSync(0, NULL, &histfileFd);
@@ -122,43 +124,182 @@ int updateHistoryFile(const char *titleID) {
     histfileFd = open(historyFilePath, O_RDONLY);
     if (histfileFd < 0) {
       // File doesn't exist
-      DPRINTF("History file at %s does not exist, creating system directory\n", historyFilePath);
-      if (createSystemDataDir()) {
-        DPRINTF("WARN: Failed to create system directory\n");
-        continue;
-      }
-      memset(historyList, 0, HISTORY_FILE_SIZE);
+      DPRINTF("History file at %s does not exist\n", historyFilePath);
+      memset(historyLists[i], 0, HISTORY_FILE_SIZE);
+      historyRewrite[i] = 1;
     } else {
       // Read history file
-      DPRINTF("Updating history file at %s\n", historyFilePath);
-      count = read(histfileFd, historyList, HISTORY_FILE_SIZE);
+      DPRINTF("Reading history file at %s\n", historyFilePath);
+      count = read(histfileFd, historyLists[i], HISTORY_FILE_SIZE);
       if (count != (HISTORY_FILE_SIZE)) {
         DPRINTF("Failed to load the history file, reinitializing\n");
-        memset(historyList, 0, HISTORY_FILE_SIZE);
+        memset(historyLists[i], 0, HISTORY_FILE_SIZE);
+        historyRewrite[i] = 1;
       }
       close(histfileFd);
     }
+    historyValid[i] = 1;
+  }
+}
+
+// Waits for the pending libmc command and returns its result
+static int mcWaitResult() {
+  int cmd, result;
+  mcSync(MC_WAIT, &cmd, &result);
+  return result;
+}
 
-    // Process history file
-    processHistoryList(titleID, historyList);
+// Writes data at offset to the history file on the memory card in the given port.
+// libmc only handles one command at a time, so every step is synced before the next one is issued
+static int mcWriteHistory(int port, int flags, int offset, void *data, int size) {
+  int fd, res;
 
-    // Write history file
-    histfileFd = open(historyFilePath, O_WRONLY | O_CREAT | O_TRUNC);
-    if (histfileFd < 0) {
-      DPRINTF("ERROR: Failed to open history file for writing: %d\n", histfileFd);
+  // Skip "mcX:" in the path
+  if (mcOpen(port, 0, &historyFilePath[4], flags) || (fd = mcWaitResult()) < 0)
+    return -EIO;
+
+  res = -EIO;
+  if (offset && (mcSeek(fd, offset, SEEK_SET) || mcWaitResult() != offset))
+    goto out;
+  if (mcWrite(fd, data, size) || mcWaitResult() != size)
+    goto out;
+  res = 0;
+
+out:
+  mcClose(fd);
+  mcWaitResult();
+  return res;
+}
+
+// Adds title ID to history files read by readHistoryFiles and writes them back.
+// Only the changed entry is written to existing files
+static void writeHistoryFiles(const char *titleID) {
+  int slot[2];
+
+  // Update the lists first, evictEntry writes history.old synchronously
+  for (int i = 0; i < 2; i++) {
+    if (!historyValid[i])
+      continue;
+
+    historyFilePath[2] = i + '0'; // Skipping int-char conversions thanks to ASCII code ordering
+    // Create the system directory for new history files
+    if (historyRewrite[i] && createSystemDataDir()) {
+      DPRINTF("WARN: Failed to create system directory\n");
+      historyValid[i] = 0;
       continue;
     }
-    // Return error if not all bytes were written
-    count = write(histfileFd, historyList, HISTORY_FILE_SIZE);
-    if (count != HISTORY_FILE_SIZE) {
-      DPRINTF("ERROR: Failed to write: %d/%d bytes written\n", count, HISTORY_FILE_SIZE);
-    }
-    close(histfileFd);
+
+    DPRINTF("Updating history file at %s\n", historyFilePath);
+    slot[i] = processHistoryList(titleID, historyLists[i]);
   }
-  // Clean up
+
+  // Write history files back to back. Both cards share the SIO2 bus, so the writes can't overlap
+  for (int i = 0; i < 2; i++) {
+    if (!historyValid[i])
+      continue;
+
+    historyFilePath[2] = i + '0';
+    int res;
+    if (historyRewrite[i])
+      res = mcWriteHistory(i, MC_O_WRONLY | MC_O_CREAT | MC_O_TRUNC, 0, historyLists[i], HISTORY_FILE_SIZE);
+    else
+      res = mcWriteHistory(i, MC_O_WRONLY, slot[i] * sizeof(struct historyListEntry), &historyLists[i][slot[i]],
+                           sizeof(struct historyListEntry));
+
+    if (res)
+      DPRINTF("ERROR: Failed to write %s: %d\n", historyFilePath, res);
+  }
+}
+
+// Reads history files while the main thread waits for the disc,
+// then waits for the title ID and writes the updated files
+static void historyThread(void *arg) {
+  readHistoryFiles();
+
+  WaitSema(historyTitleSema);
+  if (historyTitleID[0] != '\0')
+    writeHistoryFiles(historyTitleID);
+
   mcReset();
-  sceCdInit(SCECdEXIT);
+  SignalSema(historyDoneSema);
+  ExitThread();
+}
+
+// Starts reading history files from both memory cards in a separate thread.
+// Memory card modules must be loaded
+int startHistoryUpdate() {
+  ee_thread_t thread;
+  ee_thread_status_t status;
+  ee_sema_t sema = {.init_count = 0, .max_count = 1};
+
+  // Detect system directory
+  if (initSystemDataDir())
+    return -ENOENT;
+
+  if (mcInit(MC_TYPE_XMC)) {
+    DPRINTF("ERROR: Failed to initialize libmc\n");
+    return -ENODEV;
+  }
+
+  if ((historyTitleSema = CreateSema(&sema)) < 0 || (historyDoneSema = CreateSema(&sema)) < 0)
+    goto fail;
+
+  // Use the same priority as the main thread so the history thread only runs while the main thread waits for I/O
+  ReferThreadStatus(GetThreadId(), &status);
+  memset(&thread, 0, sizeof(thread));
+  thread.func = historyThread;
+  thread.stack = historyThreadStack;
+  thread.stack_size = sizeof(historyThreadStack);
+  thread.gp_reg = &_gp;
+  thread.initial_priority = status.current_priority;
+  if ((historyThreadID = CreateThread(&thread)) < 0)
+    goto fail;
+  if (StartThread(historyThreadID, NULL) < 0) {
+    DeleteThread(historyThreadID);
+    historyThreadID = -1;
+    goto fail;
+  }
   return 0;
+
+fail:
+  DPRINTF("ERROR: Failed to start the history thread\n");
+  if (historyTitleSema >= 0)
+    DeleteSema(historyTitleSema);
+  if (historyDoneSema >= 0)
+    DeleteSema(historyDoneSema);
+  historyTitleSema = historyDoneSema = -1;
+  mcReset();
+  return -ENOMEM;
+}
+
+// Passes the title ID to the history thread. NULL or invalid title ID cancels the update.
+// libcdvd must be initialized
+void setHistoryTitleID(const char *titleID) {
+  if (historyThreadID < 0)
+    return;
+
+  historyTitleID[0] = '\0';
+  // Refuse to write entry if title ID is less than expected
+  if ((titleID == NULL) || (strlen(titleID) < 11))
+    DPRINTF("WARN: Will not write invalid title ID to history files\n");
+  else {
+    strncpy(historyTitleID, titleID, sizeof(historyTitleID) - 1);
+    historyTimestamp = getTimestamp();
+  }
+
+  SignalSema(historyTitleSema);
+}
+
+// Waits for the history thread to finish writing history files
+void waitHistoryUpdate() {
+  if (historyThreadID < 0)
+    return;
+
+  WaitSema(historyDoneSema);
+  DeleteThread(historyThreadID);
+  DeleteSema(historyTitleSema);
+  DeleteSema(historyDoneSema);
+  historyThreadID = historyTitleSema = historyDoneSema = -1;
 }
 
 // Reads ROM version from rom0:ROMVER and initializes historyFilePath with region-specific letter
@@ -191,8 +332,9 @@ static inline int initSystemDataDir(void) {
 }
 
 // Processes history record list, updating title entry if it already exists in the list
-// or adding it to the list, evicting the least used title along the way
-void processHistoryList(const char *titleID, struct historyListEntry *historyList) {
+// or adding it to the list, evicting the least used title along the way.
+// Returns the index of the changed entry
+int processHistoryList(const char *titleID, struct historyListEntry *historyList) {
   // Used to find least used record
   int leastUsedRecordIdx = 0;
   int leastUsedRecordTimestamp = INT_MAX;
@@ -228,7 +370,7 @@ void processHistoryList(const char *titleID, struct historyListEntry *historyLis
     if (!strncmp(historyList[i].titleID, titleID, sizeof(historyList[i].titleID))) {
       DPRINTF("Updating entry at slot %d\n", i);
       // Update timestamp
-      historyList[i].timestamp = getTimestamp();
+      historyList[i].timestamp = historyTimestamp;
 
       // Update launch count
       if ((historyList[i].bitmask & 0x3F) != 0x3F) {
@@ -254,7 +396,7 @@ void processHistoryList(const char *titleID, struct historyListEntry *historyLis
           historyList[i].shiftAmount = 7;
         }
       }
-      return;
+      return i;
     }
   }
 
@@ -280,24 +422,56 @@ void processHistoryList(const char *titleID, struct historyListEntry *historyLis
   newEntry->launchCount = 1;
   newEntry->bitmask = 1;
   newEntry->shiftAmount = 0;
-  newEntry->timestamp = getTimestamp();
+  newEntry->timestamp = historyTimestamp;
+  return slot;
 }
 
-// Appends evicted history entry to history.old file
+// Writes evicted history entry to history.old file.
+// The file is kept as a ring of MAX_HISTORY_OLD_ENTRIES entries: new entries are appended
+// until the file is full and then replace the entry with the oldest timestamp.
+// Other launchers append to history.old without a limit, so larger files are cut down
+// to the last MAX_HISTORY_OLD_ENTRIES entries on the first write
 int evictEntry(const struct historyListEntry *evictedhistoryEntry) {
   DPRINTF("Evicting %s into history.old\n", evictedhistoryEntry->titleID);
+  struct historyListEntry oldList[MAX_HISTORY_OLD_ENTRIES];
   char fullpath[64];
   int fd, result;
 
   strcpy(fullpath, historyFilePath);
   strcat(fullpath, ".old");
-  if ((fd = open(fullpath, O_WRONLY | O_CREAT | O_APPEND)) >= 0) {
-    lseek(fd, 0, SEEK_END);
-    result = write(fd, evictedhistoryEntry, sizeof(struct historyListEntry)) == sizeof(struct historyListEntry) ? 0 : -EIO;
-    close(fd);
-  } else {
-    result = fd;
+  if ((fd = open(fullpath, O_RDWR | O_CREAT)) < 0)
+    return fd;
+
+  int count = lseek(fd, 0, SEEK_END) / sizeof(struct historyListEntry);
+  int slot = count;
+  if (count >= MAX_HISTORY_OLD_ENTRIES) {
+    // Find the oldest entry among the last MAX_HISTORY_OLD_ENTRIES entries
+    int skipped = count - MAX_HISTORY_OLD_ENTRIES;
+    lseek(fd, skipped * sizeof(struct historyListEntry), SEEK_SET);
+    count = read(fd, oldList, sizeof(oldList)) / sizeof(struct historyListEntry);
+    slot = 0;
+    for (int i = 1; i < count; i++) {
+      if (oldList[i].timestamp < oldList[slot].timestamp)
+        slot = i;
+    }
+
+    if (skipped > 0 && count > 0) {
+      // Rewrite the oversized file with the kept entries
+      DPRINTF("Trimming %d entries from history.old\n", skipped);
+      close(fd);
+      memcpy(&oldList[slot], evictedhistoryEntry, sizeof(struct historyListEntry));
+      if ((fd = open(fullpath, O_WRONLY | O_TRUNC)) < 0)
+        return fd;
+
+      result = write(fd, oldList, count * sizeof(struct historyListEntry)) == count * sizeof(struct historyListEntry) ? 0 : -EIO;
+      close(fd);
+      return result;
+    }
   }
+
+  lseek(fd, slot * sizeof(struct historyListEntry), SEEK_SET);
+  result = write(fd, evictedhistoryEntry, sizeof(struct historyListEntry)) == sizeof(struct historyListEntry) ? 0 : -EIO;
+  close(fd);
   return result;
 }
 
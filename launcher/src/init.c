@@ -1,6 +1,10 @@
 
 #include "init.h"
 #include "common.h"
+#include "trace.h"
+#ifdef CDROM
+#include "xparam_table.h"
+#endif
 #include <ctype.h>
 #include <fcntl.h>
 #include <iopcontrol.h>
@@ -117,21 +121,24 @@ char *initSMAPArguments(uint32_t *argLength);
 char *initPS2HDDArguments(uint32_t *argLength);
 char *initPS2FSArguments(uint32_t *argLength);
 
+// Devices that need memory card modules
+#define MC_DEVICES (Device_MemoryCard | Device_UDPBD | Device_CDROM)
+
 // List of modules to load
 static ModuleListEntry moduleList[] = {
     INT_MODULE(iomanX, NULL, Device_Basic),
     INT_MODULE(fileXio, NULL, Device_Basic),
 #ifdef SIO2MAN
-    INT_MODULE(sio2man, NULL, Device_MemoryCard | Device_MMCE | Device_UDPBD | Device_CDROM),
+    INT_MODULE(sio2man, NULL, MC_DEVICES | Device_MMCE),
 #else
-    EXT_MODULE(sio2man, "rom0:SIO2MAN", NULL, Device_MemoryCard | Device_UDPBD | Device_CDROM),
+    EXT_MODULE(sio2man, "rom0:SIO2MAN", NULL, MC_DEVICES),
 #endif
 #ifndef USE_ROM_MODULES
-    INT_MODULE(mcman, NULL, Device_MemoryCard | Device_UDPBD | Device_CDROM),
-    INT_MODULE(mcserv, NULL, Device_MemoryCard | Device_UDPBD | Device_CDROM),
+    INT_MODULE(mcman, NULL, MC_DEVICES),
+    INT_MODULE(mcserv, NULL, MC_DEVICES),
 #else
-    EXT_MODULE(mcman, "rom0:MCMAN", NULL, Device_MemoryCard | Device_UDPBD | Device_CDROM),
-    EXT_MODULE(mcserv, "rom0:MCSERV", NULL, Device_MemoryCard | Device_UDPBD | Device_CDROM),
+    EXT_MODULE(mcman, "rom0:MCMAN", NULL, MC_DEVICES),
+    EXT_MODULE(mcserv, "rom0:MCSERV", NULL, MC_DEVICES),
 #endif
 #ifdef MMCE
     INT_MODULE(mmceman, NULL, Device_MMCE),
@@ -185,6 +192,7 @@ int initModules(DeviceType device) {
   };
   while (!SifIopSync()) {
   };
+  traceEvent(Trace_IOPReset, device, NULL);
 
   // Initialize the RPC manager
   sceSifInitRpc(0);
@@ -220,6 +228,7 @@ int initModules(DeviceType device) {
       ret = 0;
     if (iopret == 1)
       ret = iopret;
+    traceEvent(Trace_ModuleLoad, ret, moduleList[i].name);
 
     if (ret) {
       msg("ERROR: Failed to initialize module %s: %d\n", moduleList[i].name, ret);
@@ -232,11 +241,18 @@ int initModules(DeviceType device) {
   }
 
   currentDevice = device;
+  traceEvent(Trace_ModulesReady, device, NULL);
   return 0;
 }
 
+// Returns non-zero if memory card modules are loaded for the current device
+int mcModulesLoaded() { return (currentDevice & MC_DEVICES) != 0; }
+
 // Reboots the console
 void rebootPS2() {
+  traceEvent(Trace_Exec, 0, "rom0:OSDSYS");
+  traceFlush();
+
   sceSifInitRpc(0);
   while (!SifIopReset("", 0)) {
   };
@@ -258,11 +274,62 @@ void shutdownPS2() {
 #endif
 
 #ifdef CDROM
-// Sets IOP emulation flags for Deckard consoles
+// Packs the title ID into xparamKeys format.
+// Returns 0 if the title ID is not in XXXX_NNN.NN format
+static uint64_t getXPARAMKey(const char *gameID) {
+  uint64_t key = 0;
+  for (int i = 0; i < 11; i++) {
+    if (i < 4) {
+      if (!isupper((int)gameID[i]))
+        return 0;
+      key = (key << 8) | gameID[i];
+    } else if ((i == 4) || (i == 8)) {
+      if (gameID[i] != ((i == 4) ? '_' : '.'))
+        return 0;
+    } else {
+      if (!isdigit((int)gameID[i]))
+        return 0;
+      key = (key << 4) | (gameID[i] - '0');
+    }
+  }
+  return key;
+}
+
+// Sets IOP emulation flags for Deckard consoles.
+// Looks up the title in the XPARAM table and passes the matching pairs to xparam.irx
 // Needs initModules(Device_Basic) to be called first
 void applyXPARAM(char *gameID) {
+  // Arguments are the title ID followed by up to XPARAM_MAX_PAIRS of decimal parameter and value strings
+  char args[12 + XPARAM_MAX_PAIRS * 2 * 11];
+  int argLength = 0;
+
+  uint64_t key = getXPARAMKey(gameID);
+  int low = 0;
+  int high = xparamCount - 1;
+  while (key && (low <= high)) {
+    int mid = (low + high) / 2;
+    if (xparamKeys[mid] < key)
+      low = mid + 1;
+    else if (xparamKeys[mid] > key)
+      high = mid - 1;
+    else {
+      const XParamPair *pair = &xparamPairs[XPARAM_RUN_OFFSET(xparamRuns[mid])];
+      int count = XPARAM_RUN_COUNT(xparamRuns[mid]);
+      DPRINTF("XPARAM: Found %d parameters for %s\n", count, gameID);
+
+      argLength = strlen(gameID) + 1;
+      memcpy(args, gameID, argLength);
+      for (int i = 0; i < count; i++) {
+        argLength += sprintf(&args[argLength], "%u", (unsigned int)pair[i].param) + 1;
+        argLength += sprintf(&args[argLength], "%u", (unsigned int)pair[i].value) + 1;
+      }
+      break;
+    }
+  }
+
+  // Always load the module to reset XPARAM to default values
   sceSifInitRpc(0);
-  SifExecModuleBuffer(xparam_irx, size_xparam_irx, strlen(gameID) + 1, gameID, NULL);
+  SifExecModuleBuffer(xparam_irx, size_xparam_irx, argLength, argLength ? args : NULL, NULL);
   sceSifExitRpc();
 }
 #endif
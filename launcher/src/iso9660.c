@@ -0,0 +1,159 @@
+#include "iso9660.h"
+#include "common.h"
+#include <errno.h>
+#include <libcdvd.h>
+#include <malloc.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#define ISO_SECTOR_SIZE 2048
+#define ISO_PVD_SECTOR 16
+// Number of sectors read at once starting from the PVD.
+// On mastered discs the path tables and the root directory directly follow the volume descriptors,
+// so this is usually enough to get the root directory without an extra read
+#define ISO_BATCH_SECTORS 16
+
+// Offsets in the Primary Volume Descriptor
+#define PVD_VOLUME_SIZE 80
+#define PVD_ROOT_RECORD 156
+#define PVD_VOLUME_TIMESTAMP 813
+
+// Offsets in the directory record
+#define DIR_LENGTH 0
+#define DIR_EXTENT 2
+#define DIR_SIZE 10
+#define DIR_FLAGS 25
+#define DIR_NAME_LENGTH 32
+#define DIR_NAME 33
+#define DIR_FLAG_DIRECTORY 0x02
+
+static uint32_t readLE32(const uint8_t *p) { return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24); }
+
+// Reads sectors into buffer
+static int isoReadSectors(uint32_t lba, uint32_t count, void *buffer) {
+  sceCdRMode mode = {
+      .trycount = 3,
+      .spindlctrl = SCECdSpinNom,
+      .datapattern = SCECdSecS2048,
+  };
+
+  if (!sceCdRead(lba, count, buffer, &mode) || sceCdSync(0))
+    return -EIO;
+  return 0;
+}
+
+// Searches the directory for SYSTEM.CNF and returns the pointer to its directory record
+static uint8_t *isoFindCNF(uint8_t *dir, uint32_t size) {
+  uint8_t *end = dir + size;
+  uint8_t *record = dir;
+
+  while (record < end) {
+    if (record[DIR_LENGTH] == 0) {
+      // Records don't cross sector boundaries, skip to the next sector
+      record = dir + ((record - dir) / ISO_SECTOR_SIZE + 1) * ISO_SECTOR_SIZE;
+      continue;
+    }
+    if (record + record[DIR_LENGTH] > end)
+      break;
+
+    // Match both "SYSTEM.CNF;1" and "SYSTEM.CNF"
+    uint8_t nameLength = record[DIR_NAME_LENGTH];
+    if (!(record[DIR_FLAGS] & DIR_FLAG_DIRECTORY) && (nameLength >= 10) && !strncasecmp((char *)&record[DIR_NAME], "SYSTEM.CNF", 10) &&
+        ((nameLength == 10) || (record[DIR_NAME + 10] == ';')))
+      return record;
+
+    record += record[DIR_LENGTH];
+  }
+  return NULL;
+}
+
+// Reads the PVD and the sectors following it using a single raw read.
+// libcdvd must be initialized. volumeTimestamp and volumeSize are set if the PVD is valid
+int isoReadVolumeInfo(ISODiscInfo *info) {
+  memset(info, 0, sizeof(ISODiscInfo));
+
+  // Reserve an extra byte to terminate SYSTEM.CNF
+  uint8_t *buffer = memalign(64, ISO_BATCH_SECTORS * ISO_SECTOR_SIZE + 64);
+  if (!buffer)
+    return -ENOMEM;
+  info->buffer = buffer;
+
+  // Read the PVD and the following sectors
+  if (isoReadSectors(ISO_PVD_SECTOR, ISO_BATCH_SECTORS, buffer)) {
+    DPRINTF("ISO: Failed to read PVD\n");
+    return -EIO;
+  }
+
+  // Make sure the PVD is valid
+  if ((buffer[0] != 1) || strncmp((char *)&buffer[1], "CD001", 5)) {
+    DPRINTF("ISO: Invalid PVD\n");
+    return -EINVAL;
+  }
+
+  memcpy(info->volumeTimestamp, &buffer[PVD_VOLUME_TIMESTAMP], 16);
+  info->volumeSize = readLE32(&buffer[PVD_VOLUME_SIZE]);
+
+  // Get the root directory location
+  info->rootLBA = readLE32(&buffer[PVD_ROOT_RECORD + DIR_EXTENT]);
+  info->rootSize = readLE32(&buffer[PVD_ROOT_RECORD + DIR_SIZE]);
+  if (info->rootSize > ISO_BATCH_SECTORS * ISO_SECTOR_SIZE)
+    // SYSTEM.CNF is expected to be among the first entries
+    info->rootSize = ISO_BATCH_SECTORS * ISO_SECTOR_SIZE;
+  return 0;
+}
+
+// Reads SYSTEM.CNF using raw sector reads. Must be called right after isoReadVolumeInfo.
+// Returns 0 if SYSTEM.CNF was read or the root directory doesn't have it
+int isoReadCNF(ISODiscInfo *info) {
+  uint8_t *buffer = info->buffer;
+  uint32_t rootLBA = info->rootLBA;
+  uint32_t rootSize = info->rootSize;
+  if (!buffer || !rootLBA)
+    return -EINVAL;
+
+  uint8_t *rootDir;
+  if ((rootLBA > ISO_PVD_SECTOR) && ((rootLBA - ISO_PVD_SECTOR) * ISO_SECTOR_SIZE + rootSize <= ISO_BATCH_SECTORS * ISO_SECTOR_SIZE))
+    // Root directory is already in the buffer
+    rootDir = buffer + (rootLBA - ISO_PVD_SECTOR) * ISO_SECTOR_SIZE;
+  else {
+    if (isoReadSectors(rootLBA, (rootSize + ISO_SECTOR_SIZE - 1) / ISO_SECTOR_SIZE, buffer)) {
+      DPRINTF("ISO: Failed to read the root directory\n");
+      return -EIO;
+    }
+    rootDir = buffer;
+  }
+
+  uint8_t *record = isoFindCNF(rootDir, rootSize);
+  if (!record) {
+    DPRINTF("ISO: SYSTEM.CNF not found\n");
+    return 0;
+  }
+
+  uint32_t cnfLBA = readLE32(&record[DIR_EXTENT]);
+  uint32_t cnfSize = readLE32(&record[DIR_SIZE]);
+  if (!cnfSize || cnfSize > ISO_BATCH_SECTORS * ISO_SECTOR_SIZE) {
+    DPRINTF("ISO: Bad SYSTEM.CNF size\n");
+    return -EIO;
+  }
+
+  // Read SYSTEM.CNF, reusing the buffer
+  if (isoReadSectors(cnfLBA, (cnfSize + ISO_SECTOR_SIZE - 1) / ISO_SECTOR_SIZE, buffer)) {
+    DPRINTF("ISO: Failed to read SYSTEM.CNF\n");
+    return -EIO;
+  }
+
+  buffer[cnfSize] = '\0';
+  info->cnf = (char *)buffer;
+  info->cnfSize = cnfSize;
+  return 0;
+}
+
+// Frees the sector buffer
+void isoFreeDiscInfo(ISODiscInfo *info) {
+  if (info->buffer)
+    free(info->buffer);
+  info->buffer = NULL;
+  info->cnf = NULL;
+}
@@ -1,3 +1,4 @@
+#include "trace.h"
 #include <kernel.h>
 #include <sifrpc.h>
 #include <stdint.h>
@@ -53,6 +54,8 @@ int LoadELFFromFile(int argc, char *argv[]) {
   void *pdata;
   int i;
 
+  traceEvent(Trace_ELFLoadStart, argc, argv[0]);
+
   // Wipe memory region where the ELF loader is going to be loaded (see loader/linkfile)
   memset((void *)0x00084000, 0, 0x00100000 - 0x00084000);
 
@@ -72,6 +75,9 @@ int LoadELFFromFile(int argc, char *argv[]) {
     memcpy(eph[i].vaddr, pdata, eph[i].filesz);
   }
 
+  traceEvent(Trace_ELFLoadEnd, eh->entry, argv[0]);
+  traceFlush();
+
   SifExitRpc();
   FlushCache(0);
   FlushCache(2);
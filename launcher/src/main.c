@@ -1,6 +1,7 @@
 #include "common.h"
 #include "handlers.h"
 #include "loader.h"
+#include "trace.h"
 #include <fcntl.h>
 #include <kernel.h>
 #include <ps2sdkapi.h>
@@ -14,6 +15,7 @@ void _libcglue_rtc_update() {}
 PS2_DISABLE_AUTOSTART_PTHREAD();
 
 int main(int argc, char *argv[]) {
+  traceEvent(Trace_Start, argc, (argc > 1) ? argv[1] : argv[0]);
   if (argc < 2) {
     // Try to quickboot with paths from .CNF located at the current working directory
     fail("Quickboot failed: %d", handleQuickboot(argv[0]));
@@ -30,6 +32,11 @@ int main(int argc, char *argv[]) {
     // If argv[1] is a CNF/CFG file, try to load it
     fail("Quickboot failed: %d", handleQuickboot(argv[0]));
 
+#ifdef BENCH
+  if (!strcmp("-bench", argv[0]))
+    fail("Benchmark finished: %d", handleBenchmark(argc - 1, &argv[1]));
+#endif
+
 #ifdef FMCB
   if (!strncmp("fmcb", argv[0], 4)) {
     fail("Failed to launch %s: %d", argv[0], handleFMCB(argc, argv));
@@ -0,0 +1,161 @@
+#include "trace.h"
+#include "init.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <string.h>
+#include <timer.h>
+#include <unistd.h>
+
+#define TRACE_RING_SIZE 128     // Number of events kept in memory
+#define TRACE_FILE_CAPACITY 512 // Number of records kept in the trace file
+#define TRACE_FILE_VERSION 1
+
+// Trace file header, followed by TRACE_FILE_CAPACITY records.
+// Records are written as a ring starting at the 'next' slot
+typedef struct {
+  char magic[4];       // "OTRC"
+  uint16_t version;    // TRACE_FILE_VERSION
+  uint16_t recordSize; // sizeof(TraceRecord)
+  uint32_t capacity;   // Number of record slots
+  uint32_t next;       // Slot the next record will be written to
+  uint32_t session;    // Number of the last written session
+  uint8_t reserved[12];
+} TraceFileHeader;
+
+// The 'X' in "mcX" will be replaced with memory card number
+static char traceFilePath[] = "mcX:/SYS-CONF/TRACE.BIN";
+
+static TraceRecord traceRing[TRACE_RING_SIZE];
+static uint32_t traceCount = 0; // Number of events since the last flush
+static uint32_t traceIndex = 0; // Number of events since the launcher start
+static uint64_t traceStart = 0; // Time of the first event in bus clock cycles
+static int traceStarted = 0;
+
+// Adds an event to the trace ring buffer. Long strings are truncated from the start
+void traceEvent(TraceEventType type, int value, const char *str) {
+  uint64_t now = GetTimerSystemTime();
+  if (!traceStarted) {
+    traceStart = now;
+    traceStarted = 1;
+  }
+
+  TraceRecord *record = &traceRing[traceCount % TRACE_RING_SIZE];
+  record->time = (now - traceStart) * 1000000 / kBUSCLK;
+  record->type = type;
+  record->index = traceIndex++;
+  record->value = value;
+  memset(record->str, 0, sizeof(record->str));
+  if (str) {
+    // Keep the end of the string since it's usually the most relevant part of the path
+    size_t len = strlen(str);
+    if (len > sizeof(record->str))
+      str += len - sizeof(record->str);
+    memcpy(record->str, str, (len < sizeof(record->str)) ? len : sizeof(record->str));
+  }
+  traceCount++;
+}
+
+// Opens the trace file on either memory card, creating it on the first available card if it doesn't exist
+static int traceOpenFile(TraceFileHeader *header) {
+  int fd = -1;
+  for (char i = '0'; i < '2' && fd < 0; i++) {
+    traceFilePath[2] = i;
+    fd = open(traceFilePath, O_RDWR);
+  }
+
+  if (fd >= 0) {
+    // Validate the header and make sure the next slot doesn't point past the end of the file
+    int size = lseek(fd, 0, SEEK_END);
+    lseek(fd, 0, SEEK_SET);
+    if ((read(fd, header, sizeof(TraceFileHeader)) == sizeof(TraceFileHeader)) && !memcmp(header->magic, "OTRC", 4) &&
+        (header->version == TRACE_FILE_VERSION) && (header->recordSize == sizeof(TraceRecord)) &&
+        (header->capacity == TRACE_FILE_CAPACITY)) {
+      uint32_t slots = (size - sizeof(TraceFileHeader)) / sizeof(TraceRecord);
+      if (header->next > slots)
+        header->next = slots;
+      return fd;
+    }
+
+    // Recreate the file if the header is invalid
+    close(fd);
+    fd = open(traceFilePath, O_RDWR | O_CREAT | O_TRUNC);
+  } else {
+    for (char i = '0'; i < '2' && fd < 0; i++) {
+      traceFilePath[2] = i;
+      fd = open(traceFilePath, O_RDWR | O_CREAT | O_TRUNC);
+    }
+  }
+  if (fd < 0)
+    return fd;
+
+  memset(header, 0, sizeof(TraceFileHeader));
+  memcpy(header->magic, "OTRC", 4);
+  header->version = TRACE_FILE_VERSION;
+  header->recordSize = sizeof(TraceRecord);
+  header->capacity = TRACE_FILE_CAPACITY;
+  return fd;
+}
+
+// Writes records to the ring starting at header->next
+static int traceWriteRecords(int fd, TraceFileHeader *header, TraceRecord *records, uint32_t count) {
+  while (count) {
+    uint32_t chunk = header->capacity - header->next;
+    if (chunk > count)
+      chunk = count;
+
+    lseek(fd, sizeof(TraceFileHeader) + header->next * sizeof(TraceRecord), SEEK_SET);
+    if (write(fd, records, chunk * sizeof(TraceRecord)) != chunk * sizeof(TraceRecord))
+      return -EIO;
+
+    header->next = (header->next + chunk) % header->capacity;
+    records += chunk;
+    count -= chunk;
+  }
+  return 0;
+}
+
+// Appends buffered events to the trace file on the memory card.
+// Does nothing if memory card modules are not loaded
+void traceFlush() {
+  // Loading memory card modules just for the trace would slow down every launch
+  if (!traceCount || !mcModulesLoaded())
+    return;
+
+  traceEvent(Trace_Flush, traceCount, NULL);
+
+  TraceFileHeader header;
+  int fd = traceOpenFile(&header);
+  if (fd < 0)
+    return;
+
+  // Write the session marker and the overflow record
+  TraceRecord marker[2] = {0};
+  uint32_t markerCount = 1;
+  header.session++;
+  marker[0].type = Trace_Session;
+  marker[0].value = header.session;
+  if (traceCount > TRACE_RING_SIZE) {
+    marker[1].type = Trace_Overflow;
+    marker[1].value = traceCount - TRACE_RING_SIZE;
+    markerCount++;
+  }
+  if (traceWriteRecords(fd, &header, marker, markerCount))
+    goto out;
+
+  // Write buffered events, starting with the oldest one
+  if (traceCount > TRACE_RING_SIZE) {
+    uint32_t oldest = traceCount % TRACE_RING_SIZE;
+    if (traceWriteRecords(fd, &header, &traceRing[oldest], TRACE_RING_SIZE - oldest) ||
+        traceWriteRecords(fd, &header, traceRing, oldest))
+      goto out;
+  } else if (traceWriteRecords(fd, &header, traceRing, traceCount))
+    goto out;
+
+  lseek(fd, 0, SEEK_SET);
+  if (write(fd, &header, sizeof(header)) == sizeof(header))
+    traceCount = 0;
+
+out:
+  close(fd);
+}
@@ -0,0 +1,113 @@
+#!/usr/bin/env python3
+"""Decodes the launcher trace file (mc?:/SYS-CONF/TRACE.BIN) into a readable event log.
+
+Usage: decode_trace.py TRACE.BIN [-n SESSIONS]
+"""
+import argparse
+import struct
+import sys
+
+HEADER = struct.Struct("<4sHHIII12x")
+RECORD = struct.Struct("<IHHi20s")
+
+# Must match TraceEventType in launcher/include/trace.h
+EVENTS = [
+    "session",
+    "overflow",
+    "start",
+    "iop_reset",
+    "module_load",
+    "modules_ready",
+    "device_ready",
+    "path_try",
+    "path_result",
+    "cnf_parse",
+    "elf_load_start",
+    "elf_load_end",
+    "disc_type",
+    "disc_cnf",
+    "exec",
+    "fail",
+    "flush",
+]
+
+# Must match DeviceType in launcher/include/common.h
+DEVICES = [
+    (1 << 0, "basic"),
+    (1 << 1, "mc"),
+    (1 << 2, "mmce"),
+    (1 << 3, "ata"),
+    (1 << 4, "usb"),
+    (1 << 5, "mx4sio"),
+    (1 << 6, "ilink"),
+    (1 << 7, "udpbd"),
+    (1 << 8, "hdd"),
+    (1 << 9, "cdrom"),
+]
+
+
+def device_name(value):
+    names = [name for bit, name in DEVICES if value & bit]
+    return "|".join(names) if names else "none"
+
+
+def format_value(event, value):
+    if event in ("iop_reset", "modules_ready"):
+        return device_name(value)
+    if event == "elf_load_end":
+        return "entry=0x%08x" % (value & 0xFFFFFFFF)
+    return str(value)
+
+
+def read_sessions(path):
+    with open(path, "rb") as f:
+        data = f.read()
+
+    if len(data) < HEADER.size:
+        sys.exit("%s: file is too short" % path)
+    magic, version, record_size, capacity, next_slot, session = HEADER.unpack_from(data)
+    if magic != b"OTRC" or version != 1 or record_size != RECORD.size:
+        sys.exit("%s: not a launcher trace file" % path)
+
+    slots = min(capacity, (len(data) - HEADER.size) // RECORD.size)
+    # The oldest record is at next_slot once the ring has wrapped around
+    order = list(range(next_slot, slots)) + list(range(0, next_slot))
+
+    sessions = []
+    for slot in order:
+        time, event, index, value, string = RECORD.unpack_from(data, HEADER.size + slot * RECORD.size)
+        name = EVENTS[event] if event < len(EVENTS) else "unknown(%d)" % event
+        string = string.split(b"\0", 1)[0].decode("ascii", "replace")
+        if name == "session":
+            sessions.append((value, []))
+        elif sessions:
+            # Records before the first session marker were partially overwritten
+            sessions[-1][1].append((time, index, name, value, string))
+    return sessions
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("file", help="trace file copied from the memory card")
+    parser.add_argument("-n", "--sessions", type=int, default=0, help="only print the last N sessions")
+    args = parser.parse_args()
+
+    sessions = read_sessions(args.file)
+    if args.sessions > 0:
+        sessions = sessions[-args.sessions :]
+
+    for number, events in sessions:
+        print("=== session %d ===" % number)
+        prev = None
+        for time, index, name, value, string in events:
+            if name == "overflow":
+                print("%d earlier events were lost" % value)
+                continue
+            delta = "" if prev is None else "+%.3f" % ((time - prev) / 1000)
+            prev = time
+            print("%10.3f ms %10s  #%-4d %-15s %-16s %s" % (time / 1000, delta, index, name, format_value(name, value), string))
+        print()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+"""Generates the PS1 title ID table used to identify discs without SYSTEM.CNF.
+
+Reads a CSV file with timestamp,game_id,title rows and writes a C source file with
+volume timestamps encoded as 64-bit BCD keys sorted for binary search
+and 11-byte title IDs stored in the same order.
+The CRC32 of the table is written as its version, so caches of looked up
+title IDs can tell when the table changed.
+
+Usage: gen_game_id_table.py INPUT.csv OUTPUT.c
+"""
+import argparse
+import csv
+import re
+import sys
+import zlib
+
+TIMESTAMP = re.compile(r"^\d{16}$")
+GAME_ID = re.compile(r"^[A-Z]{4}_\d{3}\.\d{2}$")
+
+
+def read_table(path):
+    table = {}
+    with open(path, newline="", encoding="utf-8") as f:
+        rows = csv.reader(line for line in f if line.strip() and not line.startswith("#"))
+        for lineno, row in enumerate(rows, 1):
+            if row[:2] == ["timestamp", "game_id"]:
+                continue
+            if len(row) < 2:
+                sys.exit("%s: row %d: expected timestamp,game_id[,title]" % (path, lineno))
+            timestamp, game_id = row[0].strip(), row[1].strip()
+            if not TIMESTAMP.match(timestamp):
+                sys.exit("%s: row %d: bad timestamp %r" % (path, lineno, timestamp))
+            if not GAME_ID.match(game_id):
+                sys.exit("%s: row %d: bad title ID %r" % (path, lineno, game_id))
+            # Several disc revisions can share the timestamp, but they must map to the same title ID
+            if table.get(timestamp, game_id) != game_id:
+                sys.exit("%s: row %d: %s maps to both %s and %s" % (path, lineno, timestamp, table[timestamp], game_id))
+            table[timestamp] = game_id
+    return table
+
+
+def table_version(table):
+    return zlib.crc32("".join("%s,%s\n" % (key, table[key]) for key in sorted(table)).encode("ascii"))
+
+
+def write_table(path, source, table):
+    # Every timestamp digit takes one nibble, so numeric order of the keys matches the timestamp order
+    keys = sorted(table)
+    version = table_version(table)
+    with open(path, "w", encoding="utf-8") as f:
+        f.write("// Generated by utils/gen_game_id_table.py from %s, do not edit\n" % source)
+        f.write('#include "game_id_table.h"\n\n')
+        f.write("const uint64_t gameIDTimestamps[] = {\n")
+        for key in keys:
+            f.write("    0x%sULL,\n" % key)
+        f.write("};\n\n")
+        f.write("const char gameIDs[][GAME_ID_LENGTH] = {\n")
+        for key in keys:
+            f.write('    "%s",\n' % table[key])
+        f.write("};\n\n")
+        f.write("const int gameIDCount = %d;\n" % len(keys))
+        f.write("const uint32_t gameIDTableVersion = 0x%08x;\n" % version)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", help="CSV file with timestamp,game_id,title rows")
+    parser.add_argument("output", help="C source file to write")
+    args = parser.parse_args()
+
+    write_table(args.output, args.input, read_table(args.input))
+
+
+if __name__ == "__main__":
+    main()
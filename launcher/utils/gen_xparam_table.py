@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+"""Generates the XPARAM table the launcher uses to configure Deckard consoles.
+
+Reads a CSV file with game_id,param,value,title rows and writes a C source file with
+title IDs packed into 64-bit keys sorted for binary search.
+Every title references a run of parameter/value pairs, identical runs are stored once.
+
+Usage: gen_xparam_table.py INPUT.csv OUTPUT.c
+"""
+import argparse
+import csv
+import re
+import sys
+
+GAME_ID = re.compile(r"^([A-Z]{4})_(\d{3})\.(\d{2})$")
+# Must match XPARAM_RUN in launcher/include/xparam_table.h
+RUN_COUNT_BITS = 3
+RUN_MAX_OFFSET = 0x1FFF
+
+# Must match xparam_types in launcher/iop/xparam/include/xparam.h
+PARAMS = [
+    "MDEC_DELAY_CYCLE",
+    "SPU_INT_DELAY_LIMIT",
+    "SPU_INT_DELAY_PPC_COEFF",
+    "SPU2_INT_DELAY_LIMIT",
+    "SPU2_INT_DELAY_PPC_COEFF",
+    "DMAC_CH10_INT_DELAY",
+    "CPU_DELAY",
+    "SPU_DMA_WAIT_LIMIT",
+    "GPU_DMA_WAIT_LIMIT",
+    "DMAC_CH10_INT_DELAY_DPC",
+    "CPU_DELAY_DPC",
+    "USB_DELAYED_INT_ENABLE",
+    "TIMER_LOAD_DELAY",
+    "SIO0_DTR_SCK_DELAY",
+    "SIO0_DSR_SCK_DELAY_C",
+    "SIO0_DSR_SCK_DELAY_M",
+    "MIPS_DCACHE_ON",
+    "CACHE_FLASH_CHANNELS",
+]
+
+
+def pack_key(game_id):
+    # Four prefix characters followed by five BCD digits, must match getXPARAMKey in launcher/src/init.c
+    m = GAME_ID.match(game_id)
+    key = 0
+    for c in m.group(1):
+        key = (key << 8) | ord(c)
+    for c in m.group(2) + m.group(3):
+        key = (key << 4) | int(c)
+    return key
+
+
+def read_table(path):
+    table = {}
+    with open(path, newline="", encoding="utf-8") as f:
+        rows = csv.reader(line for line in f if line.strip() and not line.startswith("#"))
+        for lineno, row in enumerate(rows, 1):
+            if row[:3] == ["game_id", "param", "value"]:
+                continue
+            if len(row) < 3:
+                sys.exit("%s: row %d: expected game_id,param,value[,title]" % (path, lineno))
+            game_id, param, value = (field.strip() for field in row[:3])
+            if not GAME_ID.match(game_id):
+                sys.exit("%s: row %d: bad title ID %r" % (path, lineno, game_id))
+            if param not in PARAMS:
+                sys.exit("%s: row %d: unknown parameter %r" % (path, lineno, param))
+            try:
+                value = int(value, 0)
+            except ValueError:
+                sys.exit("%s: row %d: bad value %r" % (path, lineno, value))
+            # xparam.irx parses values with strtol
+            if not 0 <= value <= 0x7FFFFFFF:
+                sys.exit("%s: row %d: value is out of range" % (path, lineno))
+
+            pairs = table.setdefault(game_id, [])
+            if (PARAMS.index(param), value) not in pairs:
+                pairs.append((PARAMS.index(param), value))
+    return table
+
+
+def write_table(path, source, table):
+    ids = sorted(table, key=pack_key)
+
+    # Store every distinct pair run once
+    pairs = []
+    runs = {}
+    for game_id in ids:
+        run = tuple(table[game_id])
+        if run not in runs:
+            runs[run] = len(pairs)
+            pairs.extend(run)
+    if len(pairs) > RUN_MAX_OFFSET or max(len(run) for run in runs) >= (1 << RUN_COUNT_BITS):
+        sys.exit("%s: too many parameter pairs for the table format" % source)
+
+    with open(path, "w", encoding="utf-8") as f:
+        f.write("// Generated by utils/gen_xparam_table.py from %s, do not edit\n" % source)
+        f.write('#include "xparam_table.h"\n\n')
+        f.write("const uint64_t xparamKeys[] = {\n")
+        for game_id in ids:
+            f.write("    0x%013xULL, // %s\n" % (pack_key(game_id), game_id))
+        f.write("};\n\n")
+        f.write("const uint16_t xparamRuns[] = {\n")
+        for game_id in ids:
+            run = tuple(table[game_id])
+            f.write("    XPARAM_RUN(%d, %d),\n" % (runs[run], len(run)))
+        f.write("};\n\n")
+        f.write("const XParamPair xparamPairs[] = {\n")
+        for param, value in pairs:
+            f.write("    {%d, 0x%x}, // %s\n" % (param, value, PARAMS[param]))
+        f.write("};\n\n")
+        f.write("const int xparamCount = %d;\n" % len(ids))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", help="CSV file with game_id,param,value,title rows")
+    parser.add_argument("output", help="C source file to write")
+    args = parser.parse_args()
+
+    write_table(args.output, args.input, read_table(args.input))
+
+
+if __name__ == "__main__":
+    main()
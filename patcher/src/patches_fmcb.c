@@ -148,14 +148,104 @@ static int dx = 0;
 static int vel, acc;
 static int offsY = 0;
 static int fontHeight = 16;
+// Values precomputed by initMenuDraw, since the drawing functions are called every frame for every menu item
+static int menuHalfHeight;         // Items are only drawn if their Y offset from the menu center is within this value
+static int menuDelimiterOffset;    // Y offset of the top and bottom delimiters
+static uint8_t menuItemAlpha[128]; // Unselected item alpha for every Y offset within menuHalfHeight
 
-// Draws selected items
-void drawMenuItemSelected(int X, int Y, uint32_t *color, int alpha, const char *string, int num) {
-  int i;
+// Copies menu colors and precomputes the visible window and the fade for scroll menu
+static void initMenuDraw() {
+  vel = settings.cursorMaxVelocity;
+  acc = settings.cursorAcceleration;
+
+  settings.displayedItems |= 1; // must be odd value
+  if (settings.displayedItems < 1)
+    settings.displayedItems = 1;
+  if (settings.displayedItems > 15)
+    settings.displayedItems = 15;
 
-  for (i = 0; i < 4; i++)
+  for (int i = 0; i < 4; i++) {
     colorSelected[i] = settings.colorSelected[i];
+    colorUnselected[i] = settings.colorUnselected[i];
+  }
+
+  menuHalfHeight = (settings.displayedItems + 1) * (fontHeight / 2);
+  menuDelimiterOffset = settings.displayedItems * (fontHeight / 2) + (fontHeight / 2);
+  int step = 128 / menuHalfHeight;
+  for (int i = 0; i < menuHalfHeight; i++) {
+    int alpha = 128 - i * step;
+    menuItemAlpha[i] = (alpha < 0) ? 0 : alpha;
+  }
+}
+
+#ifdef MENU_PROFILE
+// Optional hook profiling, enabled with MENU_PROFILE=1.
+// Counts COP0 Count ticks (CPU clock) spent in both draw hooks, OSDSYS draw calls included.
+// The totals for the last complete frame are kept in these globals and drawn under the menu.
+volatile uint32_t menuProfileFrameCycles;
+volatile uint32_t menuProfileFrameCalls;
+static uint32_t menuProfileCycles;
+static uint32_t menuProfileCalls;
+static uint32_t menuProfileStart;
+static char menuProfileText[40];
+#define MENU_PROFILE_Y 420
+
+static inline uint32_t readCount() {
+  uint32_t count;
+  asm volatile("mfc0 %0, $9" : "=r"(count));
+  return count;
+}
+
+// Item 0 is drawn first, so it starts a new frame
+static void menuProfileBegin(int num) {
+  if (num == 0) {
+    menuProfileFrameCycles = menuProfileCycles;
+    menuProfileFrameCalls = menuProfileCalls;
+    menuProfileCycles = 0;
+    menuProfileCalls = 0;
+  }
+  menuProfileStart = readCount();
+}
+
+static void menuProfileEnd() {
+  menuProfileCycles += readCount() - menuProfileStart;
+  menuProfileCalls++;
+}
+
+// Appends the decimal value to the buffer and returns the new end
+static char *menuProfileUtoa(char *buf, uint32_t value) {
+  char tmp[10];
+  int len = 0;
+  do {
+    tmp[len++] = '0' + (value % 10);
+    value /= 10;
+  } while (value);
+  while (len)
+    *buf++ = tmp[--len];
+  return buf;
+}
+
+// Draws the last frame's totals. Called from the selected item hook outside of the measured section.
+static void menuProfileDraw() {
+  char *ptr = menuProfileUtoa(menuProfileText, menuProfileFrameCycles);
+  memcpy(ptr, " cycles / ", 10);
+  ptr = menuProfileUtoa(ptr + 10, menuProfileFrameCalls);
+  memcpy(ptr, " calls", 7);
+  DrawMenuItemStringPtr(settings.menuX, MENU_PROFILE_Y, colorSelected, 0x80, menuProfileText);
+}
 
+#define MENU_PROFILE_BEGIN(num) menuProfileBegin(num)
+#define MENU_PROFILE_END() menuProfileEnd()
+#define MENU_PROFILE_DRAW() menuProfileDraw()
+#else
+#define MENU_PROFILE_BEGIN(num)
+#define MENU_PROFILE_END()
+#define MENU_PROFILE_DRAW()
+#endif
+
+// Draws selected items
+void drawMenuItemSelected(int X, int Y, uint32_t *color, int alpha, const char *string, int num) {
+  MENU_PROFILE_BEGIN(num);
   if (alpha > 0x80)
     alpha = 0x80;
 
@@ -173,7 +263,7 @@ void drawMenuItemSelected(int X, int Y, uint32_t *color, int alpha, const char *
       }
     }
     Y = (num << 1) - offsY;
-    if ((Y < ((settings.displayedItems + 1) * (fontHeight / 2))) && (Y > -((settings.displayedItems + 1) * (fontHeight / 2)))) {
+    if ((Y < menuHalfHeight) && (Y > -menuHalfHeight)) {
       vel -= acc;
       if (vel < -settings.cursorMaxVelocity || vel > settings.cursorMaxVelocity)
         acc = -acc;
@@ -182,20 +272,16 @@ void drawMenuItemSelected(int X, int Y, uint32_t *color, int alpha, const char *
       DrawMenuItemStringPtr(settings.menuX - 220 + (dx >> 8), settings.menuY + Y, colorSelected, alpha, settings.leftCursor);
       DrawMenuItemStringPtr(settings.menuX + 220 - (dx >> 8), settings.menuY + Y, colorSelected, alpha, settings.rightCursor);
     }
-    DrawMenuItemStringPtr(settings.menuX, settings.menuY - (settings.displayedItems * (fontHeight / 2) + (fontHeight / 2)), colorSelected, alpha,
-                          settings.menuDelimiterTop);
-    DrawMenuItemStringPtr(settings.menuX, settings.menuY + (settings.displayedItems * (fontHeight / 2) + (fontHeight / 2)), colorSelected, alpha,
-                          settings.menuDelimiterBottom);
+    DrawMenuItemStringPtr(settings.menuX, settings.menuY - menuDelimiterOffset, colorSelected, alpha, settings.menuDelimiterTop);
+    DrawMenuItemStringPtr(settings.menuX, settings.menuY + menuDelimiterOffset, colorSelected, alpha, settings.menuDelimiterBottom);
   }
+  MENU_PROFILE_END();
+  MENU_PROFILE_DRAW();
 }
 
 // Draws unselected items
 void drawMenuItemUnselected(int X, int Y, uint32_t *color, int alpha, const char *string, int num) {
-  int i;
-
-  for (i = 0; i < 4; i++)
-    colorUnselected[i] = settings.colorUnselected[i];
-
+  MENU_PROFILE_BEGIN(num);
   if (!(settings.patcherFlags & FLAG_SCROLL_MENU)) { // Old style menu
     DrawMenuItem(settings.menuX, Y - settings.menuItemCount * 10, colorUnselected, alpha, string);
   } else { // New style menu
@@ -209,18 +295,12 @@ void drawMenuItemUnselected(int X, int Y, uint32_t *color, int alpha, const char
         offsY -= (amount > 0 ? amount : 1);
       }
     }
+    // Skip items outside of the visible window
     Y = (num << 1) - offsY;
-    if ((Y < ((settings.displayedItems + 1) * (fontHeight / 2))) && (Y > -((settings.displayedItems + 1) * (fontHeight / 2)))) {
-      if (Y < 0)
-        alpha = 128 + (Y * (128 / ((settings.displayedItems + 1) * (fontHeight / 2))));
-      else
-        alpha = 128 - (Y * (128 / ((settings.displayedItems + 1) * (fontHeight / 2))));
-      if (alpha < 0)
-        alpha = 0;
-
-      DrawMenuItem(settings.menuX, settings.menuY + Y, colorUnselected, alpha, string);
-    }
+    if ((Y < menuHalfHeight) && (Y > -menuHalfHeight))
+      DrawMenuItem(settings.menuX, settings.menuY + Y, colorUnselected, menuItemAlpha[(Y < 0) ? -Y : Y], string);
   }
+  MENU_PROFILE_END();
 }
 
 // Patches menu drawing functions
@@ -241,15 +321,7 @@ void patchMenuDraw(uint8_t *osd) {
   uint8_t *ptr;
   uint32_t tmp, pSelItem, pUnselItem;
 
-  vel = settings.cursorMaxVelocity;
-  acc = settings.cursorAcceleration;
-
-  settings.displayedItems |= 1; // must be odd value
-  if (settings.displayedItems < 1)
-    settings.displayedItems = 1;
-  if (settings.displayedItems > 15)
-    settings.displayedItems = 15;
-
+  initMenuDraw();
   if (!menuInfo)
     return;
 
@@ -669,15 +741,7 @@ void patchMenuDrawProtokernel(uint8_t *osd) {
   uint8_t *ptr;
   uint32_t tmp, pSelItem, pUnselItem;
 
-  vel = settings.cursorMaxVelocity;
-  acc = settings.cursorAcceleration;
-
-  settings.displayedItems |= 1; // must be odd value
-  if (settings.displayedItems < 1)
-    settings.displayedItems = 1;
-  if (settings.displayedItems > 15)
-    settings.displayedItems = 15;
-
+  initMenuDraw();
   if (!menuInfo)
     return;
 
@@ -28,7 +28,7 @@ static uint16_t gsMaxX = 0;
 static uint16_t gsMaxY = 0;
 
 void gsClearScreen();
-void gsPrintBitmap(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint32_t *data);
+void gsPrintBitmap(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint32_t *palette, const uint8_t *data);
 
 // Initializes GS and displays FMCB splash screen
 void gsDisplaySplash(GSVideoMode mode) {
@@ -39,7 +39,7 @@ void gsDisplaySplash(GSVideoMode mode) {
 
   gsInit(mode);
   gsClearScreen();
-  gsPrintBitmap((640 - splashWidth) / 2, splashY, splashWidth, splashHeight, splash);
+  gsPrintBitmap((640 - splashWidth) / 2, splashY, splashWidth, splashHeight, splashPalette, splashData);
 }
 
 DECLARE_GS_PACKET(gsDMABuf, 50);
@@ -124,14 +124,53 @@ void gsClearScreen() {
   SEND_GS_PACKET(gsDMABuf);
 }
 
-#define MAX_TRANSFER 16384
+// Number of pixels decoded into each scratchpad staging buffer
+#define STAGING_PIXELS 2048
 
-// Transfers raw bitmap image to GS' memory and draws it on screen at specified coordinates
-void gsPrintBitmap(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint32_t *data) {
-  uint32_t i;       // DMA buffer loop counter
-  uint32_t frac;    // flag for whether to run a fractional buffer or not
-  uint32_t current; // number of pixels to transfer in current DMA
-  uint32_t qtotal;  // total number of qwords of data to transfer
+// Staging buffers in the scratchpad. The GIF channel reads one buffer while the other is being filled
+static uint32_t stagingBuffers[2][STAGING_PIXELS] __attribute__((section(".spad"), aligned(16)));
+
+// RLE decoder state, kept between the staging buffers
+typedef struct {
+  const uint32_t *palette;
+  const uint8_t *data;
+  uint32_t count;   // Number of pixels left in the current run
+  uint32_t literal; // Set if the current run is a literal run
+} RLEState;
+
+// Decodes count pixels into dst
+static void decodeRLE(RLEState *state, uint32_t *dst, uint32_t count) {
+  while (count) {
+    if (!state->count) {
+      // 0x00-0x7F: N+1 literal indices, 0x80-0xFF: the next index repeated N-127 times
+      uint8_t ctrl = *state->data++;
+      state->literal = !(ctrl & 0x80);
+      state->count = (ctrl & 0x7F) + 1;
+    }
+
+    uint32_t n = (state->count < count) ? state->count : count;
+    state->count -= n;
+    count -= n;
+    if (state->literal) {
+      while (n--)
+        *dst++ = state->palette[*state->data++];
+    } else {
+      uint32_t color = state->palette[*state->data];
+      while (n--)
+        *dst++ = color;
+      // Advance past the index once the run is complete
+      if (!state->count)
+        state->data++;
+    }
+  }
+}
+
+// Decodes RLE-compressed palettized image and draws it on screen at specified coordinates.
+// The image is decoded in chunks into the scratchpad while the previous chunk is being transferred to GS
+void gsPrintBitmap(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint32_t *palette, const uint8_t *data) {
+  RLEState state = {palette, data, 0, 0};
+  uint32_t remaining = w * h; // Number of pixels left to transfer, always a multiple of 4
+  int current = 0;            // Staging buffer being filled
 
   BEGIN_GS_PACKET(gsDMABuf);
   GIF_TAG_AD(gsDMABuf, 4, 1, 0, 0, 0);
@@ -145,25 +184,23 @@ void gsPrintBitmap(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint32_t *dat
   GIF_DATA_AD(gsDMABuf, GS_REG_TRXDIR, GS_TRXDIR(XDIR_EE_GS));
   SEND_GS_PACKET(gsDMABuf);
 
-  qtotal = w * h / 4;              // total number of quadwords to transfer.
-  current = qtotal % MAX_TRANSFER; // work out if a partial buffer transfer is needed.
-  frac = 1;                        // assume yes.
-  if (!current)                    // if there is no need for partial buffer
-  {
-    current = MAX_TRANSFER; // start with a full buffer
-    frac = 0;               // and don't do extra partial buffer first
-  }
-  for (i = 0; i < (qtotal / MAX_TRANSFER) + frac; i++) {
-    BEGIN_GS_PACKET(gsDMABuf);
-    GIF_TAG_IMG(gsDMABuf, current);
-    SEND_GS_PACKET(gsDMABuf);
+  // GIF keeps consuming image data across DMA transfers, so a single tag covers the whole image
+  BEGIN_GS_PACKET(gsDMABuf);
+  GIF_TAG_IMG(gsDMABuf, remaining / 4);
+  SEND_GS_PACKET(gsDMABuf);
 
-    SET_QWC(GIF_QWC, current);
-    SET_MADR(GIF_MADR, data, 0);
-    SET_CHCR(GIF_CHCR, 1, 0, 0, 0, 0, 1, 0);
+  while (remaining) {
+    uint32_t count = (remaining < STAGING_PIXELS) ? remaining : STAGING_PIXELS;
+    decodeRLE(&state, stagingBuffers[current], count);
+
+    // Wait for the other buffer to be transferred and start transferring this one from the scratchpad
     DMA_WAIT(GIF_CHCR);
+    SET_QWC(GIF_QWC, count / 4);
+    SET_MADR(GIF_MADR, (uint32_t)stagingBuffers[current] & 0x3FFF, 1);
+    SET_CHCR(GIF_CHCR, 1, 0, 0, 0, 0, 1, 0);
 
-    data += current * 4;
-    current = MAX_TRANSFER; // after the first one, all are full buffers
+    current ^= 1;
+    remaining -= count;
   }
+  DMA_WAIT(GIF_CHCR);
 }
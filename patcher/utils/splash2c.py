@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+"""Converts the splash image into a palettized RLE-compressed C header.
+
+Accepts an uncompressed 24/32-bit BMP file or a header previously generated by BMP2C.
+Every pixel is replaced with an index into a palette of up to 256 colors and the index stream is RLE-compressed:
+- 0x00-0x7F: N+1 literal indices follow
+- 0x80-0xFF: the next index is repeated N-127 times
+
+Usage: splash2c.py INPUT.bmp|INPUT.h OUTPUT.h
+"""
+import argparse
+import os
+import re
+import struct
+import sys
+
+MAX_RUN = 128
+
+
+def read_bmp(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:2] != b"BM":
+        sys.exit("%s: not a BMP file" % path)
+    offset = struct.unpack_from("<I", data, 10)[0]
+    width, height, planes, bpp, compression = struct.unpack_from("<iiHHI", data, 18)
+    if bpp not in (24, 32) or compression not in (0, 3):
+        sys.exit("%s: only uncompressed 24-bit and 32-bit BMP files are supported" % path)
+
+    stride = (width * (bpp // 8) + 3) & ~3
+    rows = range(abs(height) - 1, -1, -1) if height > 0 else range(abs(height))  # BMP rows are stored bottom-up by default
+    pixels = []
+    for y in rows:
+        row = offset + y * stride
+        for x in range(width):
+            b, g, r = data[row + x * (bpp // 8) : row + x * (bpp // 8) + 3]
+            # GS stores 32-bit pixels as ABGR
+            pixels.append(r | (g << 8) | (b << 16))
+    return width, abs(height), pixels
+
+
+def read_bmp2c(path):
+    with open(path, encoding="utf-8") as f:
+        text = f.read()
+    width = re.search(r"splashWidth\s*=\s*(\d+)", text)
+    height = re.search(r"splashHeight\s*=\s*(\d+)", text)
+    body = re.search(r"splash\[\]\s*=\s*\{(.*?)\};", text, re.S)
+    if not (width and height and body):
+        sys.exit("%s: not a BMP2C header" % path)
+    body = re.sub(r"//[^\n]*", "", body.group(1))
+    pixels = [int(value, 16) for value in re.findall(r"0x([0-9a-fA-F]+)", body)]
+    return int(width.group(1)), int(height.group(1)), pixels
+
+
+def compress(indices):
+    out = bytearray()
+    i = 0
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:MAX_RUN]
+            del literal[:MAX_RUN]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+
+    while i < len(indices):
+        run = 1
+        while i + run < len(indices) and run < MAX_RUN and indices[i + run] == indices[i]:
+            run += 1
+        # Runs shorter than 3 pixels are cheaper to store as literals
+        if run >= 3:
+            flush_literal()
+            out.append(0x80 | (run - 1))
+            out.append(indices[i])
+        else:
+            literal.extend(indices[i : i + run])
+        i += run
+    flush_literal()
+    return out
+
+
+def write_header(path, source, width, height, palette, data):
+    with open(path, "w", encoding="utf-8") as f:
+        f.write("// File generated by utils/splash2c.py from %s\n" % os.path.basename(source))
+        f.write("#include <stdint.h>\n\n")
+        f.write("uint32_t splashWidth = %d;\n" % width)
+        f.write("uint32_t splashHeight = %d;\n\n" % height)
+        f.write("// Image colors\n")
+        f.write("uint32_t splashPalette[] = {\n")
+        for color in palette:
+            f.write("    0x%08x,\n" % color)
+        f.write("};\n\n")
+        f.write("// RLE-compressed palette indices, see gsPrintBitmap in src/splash.c\n")
+        f.write("uint8_t splashData[] = {\n")
+        for i in range(0, len(data), 16):
+            f.write("    " + " ".join("0x%02x," % b for b in data[i : i + 16]) + "\n")
+        f.write("};\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", help="BMP file or BMP2C header")
+    parser.add_argument("output", help="header file to write")
+    args = parser.parse_args()
+
+    if args.input.lower().endswith(".h"):
+        width, height, pixels = read_bmp2c(args.input)
+    else:
+        width, height, pixels = read_bmp(args.input)
+    if len(pixels) != width * height:
+        sys.exit("%s: expected %d pixels, got %d" % (args.input, width * height, len(pixels)))
+    # The image is sent to GS in quadwords
+    if (width * height) % 4:
+        sys.exit("%s: the number of pixels must be a multiple of 4" % args.input)
+
+    palette = sorted(set(pixels))
+    if len(palette) > 256:
+        sys.exit("%s: the image has %d colors, up to 256 are supported" % (args.input, len(palette)))
+    lookup = {color: i for i, color in enumerate(palette)}
+    data = compress([lookup[p] for p in pixels])
+
+    write_header(args.output, args.input, width, height, palette, data)
+    print("%dx%d, %d colors, %d bytes of RLE data (%d bytes raw)" % (width, height, len(palette), len(data), len(pixels) * 4))
+
+
+if __name__ == "__main__":
+    main()